@@ -0,0 +1,575 @@
+"""Parameterized benchmark inputs for the otter object families.
+
+Every case is a (name, parameters, input text) triple. The inputs only differ in the mesh size
+and the object parameters being swept, and all end with the same metrics block, so that the
+results of different cases and different builds can be compared directly.
+"""
+
+# Perf graph sections timed for every case; adjust if the framework renames them
+RESIDUAL_SECTION = 'FEProblem::computeResidualInternal'
+JACOBIAN_SECTION = 'FEProblem::computeJacobianInternal'
+
+METRICS = """
+[Postprocessors]
+  [nl_step]
+    type = NumNonlinearIterations
+    outputs = none
+  []
+  [nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_step
+  []
+  [l_step]
+    type = NumLinearIterations
+    outputs = none
+  []
+  [l_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = l_step
+  []
+  [residual_time]
+    type = PerfGraphData
+    section_name = '{residual}'
+    data_type = TOTAL
+  []
+  [residual_calls]
+    type = PerfGraphData
+    section_name = '{residual}'
+    data_type = CALLS
+  []
+  [jacobian_time]
+    type = PerfGraphData
+    section_name = '{jacobian}'
+    data_type = TOTAL
+  []
+  [jacobian_calls]
+    type = PerfGraphData
+    section_name = '{jacobian}'
+    data_type = CALLS
+  []
+  {extra}
+[]
+{blocks}
+[Outputs]
+  file_base = {name}
+  csv = true
+  perf_graph = true
+[]
+"""
+
+
+def metrics(name, extra='', blocks=''):
+    """Metrics block; extra is added to the postprocessors and blocks after them."""
+    return METRICS.format(residual=RESIDUAL_SECTION, jacobian=JACOBIAN_SECTION, name=name,
+                          extra=extra, blocks=blocks)
+
+
+def nonlocal_truss(n):
+    name = 'nonlocal_truss_n%d' % n
+    text = """
+[Mesh]
+  [truss]
+    type = GeneratedMeshGenerator
+    dim = 1
+    xmax = 100
+    nx = {n}
+  []
+[]
+
+[GlobalParams]
+  displacements = 'disp_x'
+[]
+
+[Variables]
+  [disp_x]
+  []
+[]
+
+[AuxVariables]
+  [area]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [area]
+    type = ConstantAux
+    variable = area
+    value = 1.0
+    execute_on = 'initial timestep_begin'
+  []
+[]
+
+[Functions]
+  [load]
+    type = PiecewiseLinear
+    x = '0 1'
+    y = '0 0.011'
+  []
+[]
+
+[BCs]
+  [fixx1]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0.0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = 'load'
+  []
+[]
+
+[Kernels]
+  [solid]
+    type = StressDivergenceTensorsTruss
+    component = 0
+    variable = disp_x
+    area = area
+  []
+[]
+
+[Materials]
+  [truss]
+    type = NonlocalTruss
+    youngs_modulus = 20000
+    yield_stress = 2
+    hardening_constant = -2000
+    characteristic_length = 5
+    alpha = -16
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_abs_tol = 1e-8
+  nl_max_its = 100
+  dt = 0.25
+  end_time = 1
+  line_search = none
+  [Quadrature]
+    type = GAUSS
+    order = FIRST
+  []
+[]
+""".format(n=n)
+    return name, {'family': 'NonlocalTruss', 'elements': n}, text + metrics(name)
+
+
+BEAM_VARIABLES = """
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+"""
+
+
+def beam_kernels(kernel):
+    blocks = []
+    for i, var in enumerate(['disp_x', 'disp_y', 'disp_z', 'rot_x', 'rot_y', 'rot_z']):
+        blocks.append("""  [solid_{var}]
+    type = {kernel}
+    variable = {var}
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = {i}
+  []""".format(var=var, kernel=kernel, i=i))
+    return '[Kernels]\n' + '\n'.join(blocks) + '\n[]\n'
+
+
+def cantilever_bcs(load):
+    blocks = []
+    for var in ['disp_x', 'disp_y', 'disp_z', 'rot_x', 'rot_y', 'rot_z']:
+        blocks.append("""  [fix_{var}]
+    type = DirichletBC
+    variable = {var}
+    boundary = left
+    value = 0
+  []""".format(var=var))
+    blocks.append("""  [load]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = right
+    function = '{load}'
+  []""".format(load=load))
+    return '[BCs]\n' + '\n'.join(blocks) + '\n[]\n'
+
+
+BEAM_EXECUTIONER = """
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  dt = {dt}
+  end_time = {end_time}
+  nl_abs_tol = 1e-8
+[]
+"""
+
+
+def layered_beam(num_layers, elements):
+    name = 'layered_beam_l%d_n%d' % (num_layers, elements)
+    text = """
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = {n}
+  xmin = 0
+  xmax = 3000
+[]
+""".format(n=elements) + BEAM_VARIABLES + """
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = LayeredBeam
+    num_layers = {layers}
+    Iy = 337500000
+    Iz = 84375000
+    area = 45000
+    depth = 300
+    width = 150
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_stress = '0.25'
+    hardening_constant = '0.25'
+  []
+  [stress]
+    type = ComputeBeamResultantsl
+  []
+[]
+""".format(layers=num_layers) + beam_kernels('StressDivergenceBeam') + cantilever_bcs(
+        '10*t') + BEAM_EXECUTIONER.format(dt=2, end_time=10)
+    return name, {'family': 'LayeredBeam', 'layers': num_layers,
+                  'elements': elements}, text + metrics(name)
+
+
+def plastic_beam(large_strain, elements=100):
+    name = 'plastic_beam_%s_n%d' % ('large' if large_strain else 'small', elements)
+    text = """
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = {n}
+  xmin = 0
+  xmax = 3000
+[]
+""".format(n=elements) + BEAM_VARIABLES + """
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = PlasticBeam
+    num_layers = 6
+    Iy = 337500000
+    Iz = 84375000
+    area = 45000
+    depth = 300
+    width = 150
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_moment = '843750'
+    hardening_constant = '1.771875e10'
+    large_strain = {large}
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+""".format(large='true' if large_strain else 'false') + beam_kernels(
+        'StressDivergenceBeam') + cantilever_bcs('10*t') + BEAM_EXECUTIONER.format(dt=2,
+                                                                               end_time=10)
+    return name, {'family': 'PlasticBeam', 'large_strain': large_strain,
+                  'elements': elements}, text + metrics(name)
+
+
+RADIAL_RETURN_MODELS = {
+    'KinematicPlasticityStressUpdate': 'yield_stress = 0.25\n    hardening_constant = 21',
+    'Bilin1': 'yield_stress = 0.25\n    hardening_constant = 21\n    deterioration_constant = -2\n'
+              '    peak_strength = 0.4',
+    'CombinedHardeningStressUpdatel': 'yield_stress = 0.25\n    hardening_constant = 21\n'
+                                      '    deterioration_constant = -2\n    peak_strength = 0.4',
+    'SelectiveHardeningStressUpdate': 'yield_stress = 0.25\n    hardening_constant = 21',
+}
+
+
+def radial_return(model, elements):
+    name = 'radial_return_%s_n%d' % (model, elements)
+    text = """
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [strip]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = {n}
+    ny = 1
+    nz = 1
+    xmax = {n}
+    elem_type = HEX20
+  []
+[]
+
+[Modules/TensorMechanics/Master]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+  []
+[]
+
+[Functions]
+  [load1]
+    type = PiecewiseLinear
+    x = '0 1 3 5'
+    y = '0 0.05 -0.05 0.01'
+  []
+[]
+
+[Materials]
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = 'plasticity'
+  []
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 210
+    poissons_ratio = 0.3
+  []
+  [plasticity]
+    type = {model}
+    {params}
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = load1
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-8
+  dt = 0.05
+  end_time = 5
+[]
+""".format(n=elements, model=model, params=RADIAL_RETURN_MODELS[model])
+    return name, {'family': 'RadialReturn', 'model': model,
+                  'elements': elements}, text + metrics(name)
+
+
+def beam_stress(num_points, batched):
+    name = 'beam_stress_%s_p%d' % ('sampler' if batched else 'single', num_points)
+    xs = [3000.0 * (i + 0.5) / num_points for i in range(num_points)]
+    extra = ''
+    blocks = ''
+    if batched:
+        blocks = """
+[VectorPostprocessors]
+  [stress]
+    type = BeamSectionStressSampler
+    points = '{points}'
+    section = rectangular
+    depth = 300
+    width = 150
+    y_locations = '0 1'
+    z_locations = '0.5 0.5'
+    stress_components = '11 12'
+  []
+[]
+""".format(points=' '.join('%g 0 0' % x for x in xs))
+    else:
+        pps = []
+        for i, x in enumerate(xs):
+            for component in ['11', '12']:
+                pps.append("""[s{c}_{i}]
+    type = RectangularBeamStress
+    point = '{x} 0 0'
+    stress_component = {c}
+    depth = 300
+    width = 150
+    y_location = 1
+    z_location = 0.5
+    outputs = none
+  []""".format(c=component, i=i, x=x))
+        extra = '\n  '.join(pps)
+
+    text = """
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 200
+  xmin = 0
+  xmax = 3000
+[]
+""" + BEAM_VARIABLES + """
+[AuxVariables]
+  [forces_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [forces_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [forces_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [forces_x]
+    type = MaterialRealVectorValueAux
+    property = forces
+    component = 0
+    variable = forces_x
+  []
+  [forces_y]
+    type = MaterialRealVectorValueAux
+    property = forces
+    component = 1
+    variable = forces_y
+  []
+  [forces_z]
+    type = MaterialRealVectorValueAux
+    property = forces
+    component = 2
+    variable = forces_z
+  []
+  [moments_x]
+    type = MaterialRealVectorValueAux
+    property = moments
+    component = 0
+    variable = moments_x
+  []
+  [moments_y]
+    type = MaterialRealVectorValueAux
+    property = moments
+    component = 1
+    variable = moments_y
+  []
+  [moments_z]
+    type = MaterialRealVectorValueAux
+    property = moments
+    component = 2
+    variable = moments_z
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrain
+    Iy = 337500000
+    Iz = 84375000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+""" + beam_kernels('StressDivergenceBeam') + cantilever_bcs('10*t') + BEAM_EXECUTIONER.format(
+        dt=1, end_time=20)
+    return name, {'family': 'BeamStress', 'points': num_points,
+                  'batched': batched}, text + metrics(name, extra, blocks)
+
+
+def all_cases(quick=False):
+    """The full sweep, or a small subset of every family for smoke testing."""
+    cases = []
+    for n in ([100, 1000] if quick else [100, 1000, 5000, 10000, 50000]):
+        cases.append(nonlocal_truss(n))
+    for layers in ([10] if quick else [10, 50, 100]):
+        for n in ([1000] if quick else [1000, 10000, 100000]):
+            cases.append(layered_beam(layers, n))
+    for large_strain in [False, True]:
+        cases.append(plastic_beam(large_strain))
+    for model in sorted(RADIAL_RETURN_MODELS):
+        for n in ([10] if quick else [10, 100, 1000]):
+            cases.append(radial_return(model, n))
+    for points in ([10] if quick else [10, 100, 1000]):
+        for batched in [False, True]:
+            cases.append(beam_stress(points, batched))
+    return cases
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Compares benchmark results against a baseline and flags regressions.
+
+    ./compare.py baseline.json results.json [--threshold 0.1]
+
+A case regresses when one of its timings, iteration counts or its peak RSS grows by more than
+the threshold (relative) over the baseline. Timings below --min-time seconds are ignored as
+noise. The exit status is 1 if any case regressed or failed, so the script can gate CI.
+"""
+import argparse
+import json
+import sys
+
+METRICS = ['wall_time', 'time_per_residual', 'time_per_jacobian', 'nl_its', 'l_its',
+           'peak_rss_mb']
+TIMINGS = {'wall_time', 'time_per_residual', 'time_per_jacobian'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline')
+    parser.add_argument('results')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='allowed relative increase (default 0.1)')
+    parser.add_argument('--min-time', type=float, default=1e-3,
+                        help='timings below this are not compared (s)')
+    args = parser.parse_args()
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)['cases']
+    with open(args.results) as f:
+        results = json.load(f)['cases']
+
+    failed = False
+    print('%-45s %-18s %12s %12s %8s' % ('case', 'metric', 'baseline', 'current', 'change'))
+    for name in sorted(results):
+        current = results[name]
+        if current.get('status') != 'ok':
+            print('%-45s %s' % (name, current.get('status')))
+            failed = True
+            continue
+        if name not in baseline or baseline[name].get('status') != 'ok':
+            print('%-45s %s' % (name, 'no baseline'))
+            continue
+
+        for metric in METRICS:
+            old = baseline[name].get(metric)
+            new = current.get(metric)
+            if old is None or new is None or old <= 0:
+                continue
+            if metric in TIMINGS and old < args.min_time:
+                continue
+            change = (new - old) / old
+            flag = ''
+            if change > args.threshold:
+                flag = 'REGRESSION'
+                failed = True
+            elif change < -args.threshold:
+                flag = 'improved'
+            if flag:
+                print('%-45s %-18s %12.4g %12.4g %+7.1f%% %s' % (name, metric, old, new,
+                                                                  100 * change, flag))
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
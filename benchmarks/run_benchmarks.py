@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Generates the benchmark inputs, runs them and writes the measurements to a JSON file.
+
+    ./run_benchmarks.py --executable ../otter-opt --output results.json [--quick] [--filter truss]
+
+For each case the file records the wall time of the whole run, the time and number of calls of
+the residual and Jacobian evaluations (from the perf graph), the cumulative nonlinear and linear
+iterations and the peak resident set size of the run.
+"""
+import argparse
+import csv
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import threading
+import time
+
+import cases
+
+
+def rss_mb(usage):
+    """ru_maxrss is in kB on Linux and in bytes on macOS."""
+    scale = 1.0 / 1024.0 if platform.system() == 'Linux' else 1.0 / (1024.0 * 1024.0)
+    return usage.ru_maxrss * scale
+
+
+def last_row(csv_file):
+    with open(csv_file) as f:
+        rows = list(csv.DictReader(f))
+    return {k: float(v) for k, v in rows[-1].items()} if rows else {}
+
+
+def run_case(executable, name, params, text, work_dir, mpi_procs, timeout):
+    input_file = os.path.join(work_dir, name + '.i')
+    with open(input_file, 'w') as f:
+        f.write(text)
+
+    command = [executable, '-i', os.path.basename(input_file)]
+    if mpi_procs > 1:
+        command = ['mpiexec', '-n', str(mpi_procs)] + command
+
+    # wait4 returns the resource usage of this child only, i.e. the peak RSS of this case (of
+    # the launcher when run under mpiexec)
+    log_file = os.path.join(work_dir, name + '.log')
+    with open(log_file, 'w') as log:
+        start = time.perf_counter()
+        proc = subprocess.Popen(command, cwd=work_dir, stdout=log, stderr=subprocess.STDOUT)
+        timer = threading.Timer(timeout, proc.kill)
+        timer.start()
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.perf_counter() - start
+        timed_out = not timer.is_alive()
+        timer.cancel()
+    proc.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+
+    result = dict(params)
+    result['status'] = 'timeout' if timed_out else ('ok' if proc.returncode == 0 else 'failed')
+    result['wall_time'] = wall
+    result['peak_rss_mb'] = rss_mb(usage)
+    if result['status'] != 'ok':
+        with open(log_file) as log:
+            result['log_tail'] = log.read()[-2000:]
+        return result
+
+    csv_file = os.path.join(work_dir, name + '.csv')
+    if not os.path.exists(csv_file):
+        result['status'] = 'failed'
+        result['log_tail'] = 'no output file ' + csv_file
+        return result
+    values = last_row(csv_file)
+    for key in ['nl_its', 'l_its', 'residual_time', 'residual_calls', 'jacobian_time',
+                'jacobian_calls']:
+        result[key] = values.get(key)
+    if result['residual_calls']:
+        result['time_per_residual'] = result['residual_time'] / result['residual_calls']
+    if result['jacobian_calls']:
+        result['time_per_jacobian'] = result['jacobian_time'] / result['jacobian_calls']
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executable', required=True, help='otter executable')
+    parser.add_argument('--output', default='results.json', help='results file')
+    parser.add_argument('--work-dir', default='work', help='directory of the generated inputs')
+    parser.add_argument('--quick', action='store_true', help='small subset of every family')
+    parser.add_argument('--filter', default='', help='regular expression on the case names')
+    parser.add_argument('-n', '--mpi-procs', type=int, default=1, help='MPI processes per case')
+    parser.add_argument('--timeout', type=float, default=3600, help='timeout per case in s')
+    parser.add_argument('--list', action='store_true', help='only list the cases')
+    args = parser.parse_args()
+
+    selected = [c for c in cases.all_cases(args.quick) if re.search(args.filter, c[0])]
+    if args.list:
+        for name, params, _ in selected:
+            print(name, params)
+        return 0
+
+    executable = os.path.abspath(args.executable)
+    os.makedirs(args.work_dir, exist_ok=True)
+
+    results = {}
+    for name, params, text in selected:
+        print('%-50s' % name, end='', flush=True)
+        result = run_case(executable, name, params, text, args.work_dir, args.mpi_procs,
+                          args.timeout)
+        results[name] = result
+        print('%-8s %10.2f s' % (result['status'], result.get('wall_time', float('nan'))))
+
+    report = {'host': platform.node(), 'mpi_procs': args.mpi_procs,
+              'date': time.strftime('%Y-%m-%d %H:%M:%S'), 'cases': results}
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+
+    return 0 if all(r['status'] == 'ok' for r in results.values()) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,41 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Action.h"
+
+/**
+ * Preconditioning of 6 DOF beam models, set up by a [BeamPreconditioning] block. The rotation
+ * rows of the beam stiffness scale with EI/L and the displacement rows with EA/L, orders of
+ * magnitude apart for slender sections, which makes ILU and plain AMG degrade with the mesh size.
+ * The rotation variables are scaled by A/I so both kinds of rows are of the same magnitude, and
+ * PETSc is set up for the nodal structure of the system: a field split of the displacements and
+ * rotations with AMG on each field, or the nodal 6x6 blocks for point block Jacobi or AMG.
+ *
+ * The nodal blocks are those of a system holding only the three displacement and three rotation
+ * variables, declared in this order with the same FE type, so that libMesh interleaves their
+ * DOFs by node.
+ */
+class BeamPreconditioningAction : public Action
+{
+public:
+  static InputParameters validParams();
+
+  BeamPreconditioningAction(const InputParameters & parameters);
+
+  virtual void act() override;
+
+protected:
+  /// Errors out unless the variables form a single, node interleaved group of 6 DOFs per node
+  void checkNodalBlocks() const;
+
+  const std::vector<VariableName> _displacements;
+  const std::vector<VariableName> _rotations;
+};
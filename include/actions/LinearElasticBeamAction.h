@@ -0,0 +1,34 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Action.h"
+
+/**
+ * Linear mode for small strain elastic beam models, set up by a [LinearElasticBeam] block. The
+ * beam stiffness does not change, so the Jacobian is assembled and factorized (or the AMG
+ * hierarchy set up) once, at the first Newton iteration of the first solve, and reused for every
+ * later iteration, load step and time step; each step is then a residual assembly and a
+ * back-substitution, and Newton converges in one iteration.
+ *
+ * The materials are not checked: using this mode only for linear models is the user's
+ * responsibility. For a model that is not linear (large_strain, plasticity) the reused Jacobian
+ * turns Newton into a modified Newton method, which converges slowly or stalls, and whose
+ * solution only matches the full Newton solution to within the nonlinear tolerances.
+ */
+class LinearElasticBeamAction : public Action
+{
+public:
+  static InputParameters validParams();
+
+  LinearElasticBeamAction(const InputParameters & parameters);
+
+  virtual void act() override;
+};
@@ -0,0 +1,32 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PetscSupport.h"
+
+/**
+ * Solver setup shared by the actions that configure PETSc for the beam models.
+ */
+namespace PetscOptionOverride
+{
+/// Sets a PETSc option, replacing the value given in the input file if there is one
+inline void
+set(Moose::PetscSupport::PetscOptions & petsc, const std::string & name, const std::string & value)
+{
+  for (std::size_t i = 0; i < petsc.inames.size(); ++i)
+    if (petsc.inames[i] == name)
+    {
+      petsc.values[i] = value;
+      return;
+    }
+  petsc.inames.push_back(name);
+  petsc.values.push_back(value);
+}
+}
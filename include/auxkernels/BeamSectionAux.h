@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+
+#include <unordered_map>
+
+/**
+ * Elemental field of a section property (area, Iy, Iz or Ix) computed from the section geometry
+ * of the block of every element, e.g. the section blocks of BeamMeshGenerator. The beam materials
+ * couple the fields as area, Iy, Iz and Ix, so every section is described once instead of in every
+ * material block. The dimensions of a section are given per shape (see BeamSectionStress for the
+ * local axes): rectangular 'depth width' (depth along y), circular 'radius' and pipe
+ * 'radius thickness'. The torsion constant of a rectangle is Roark's approximation
+ * a b^3 (1/3 - 0.21 b/a (1 - b^4 / (12 a^4))) with a >= b.
+ */
+class BeamSectionAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  BeamSectionAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  /// Property value of every section block
+  std::unordered_map<SubdomainID, Real> _values;
+};
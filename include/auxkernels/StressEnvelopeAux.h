@@ -0,0 +1,39 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+#include "StressEnvelopeQuantity.h"
+
+/**
+ * Elemental field of the maximum or minimum of a stress measure (see StressEnvelopeQuantity)
+ * over the qps and section points of each element. With running = true the field keeps the
+ * extreme over all time steps, i.e. the time envelope of every element.
+ */
+class StressEnvelopeAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  StressEnvelopeAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  StressEnvelopeQuantity _quantity;
+
+  /// 1 for the maximum, -1 for the minimum
+  const Real _sign;
+
+  const bool _running;
+
+  /// Element extreme, evaluated once per element rather than once per qp
+  Real _cached_value;
+};
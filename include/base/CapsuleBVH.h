@@ -0,0 +1,137 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+/**
+ * Bounding volume hierarchy over swept primitives for beam contact. A primitive is a capsule, a
+ * segment swept by a radius (a beam element axis, or a zero radius surface edge of a 2D solid),
+ * or a triangle of a solid surface. The boxes of the nodes are axis aligned.
+ *
+ * The tree is built top down by median splits along the longest axis. As the mesh deforms,
+ * update() only refits the boxes bottom up, which keeps the topology and costs one pass over the
+ * primitives. The tree is rebuilt when the number of primitives changes or when the refitted
+ * boxes have grown so much (summed surface area over rebuild_ratio times that after the last
+ * build) that the broad phase would become loose.
+ *
+ * The narrow phase helpers return the closest points of two segments and of a segment and a
+ * triangle.
+ */
+class CapsuleBVH
+{
+public:
+  struct Primitive
+  {
+    /// Segment end points, or the three triangle vertices
+    std::array<Point, 3> points;
+    /// 2 for a capsule, 3 for a triangle
+    unsigned int n_points;
+    Real radius;
+  };
+
+  typedef std::pair<unsigned int, unsigned int> PrimitivePair;
+
+  CapsuleBVH(Real rebuild_ratio = 1.5);
+
+  /// Builds the tree over the primitives, inflating every box by the margin
+  void build(const std::vector<Primitive> & primitives, Real margin);
+
+  /// Refits the tree to the moved primitives, rebuilding it if needed
+  void update(const std::vector<Primitive> & primitives, Real margin);
+
+  /// All pairs (i < j) of primitives whose boxes overlap
+  void overlappingPairs(std::vector<PrimitivePair> & pairs) const;
+
+  /// Number of builds since construction
+  unsigned int builds() const { return _builds; }
+
+  /**
+   * Closest points c1 = p1 + s (q1 - p1) and c2 = p2 + t (q2 - p2) of two segments,
+   * with s, t in [0, 1]
+   */
+  static void closestSegmentSegment(const Point & p1,
+                                    const Point & q1,
+                                    const Point & p2,
+                                    const Point & q2,
+                                    Real & s,
+                                    Real & t,
+                                    Point & c1,
+                                    Point & c2);
+
+  /// Closest point of the triangle abc to p
+  static Point
+  closestPointTriangle(const Point & p, const Point & a, const Point & b, const Point & c);
+
+  /**
+   * Closest points of the segment pq (c1, at parameter s) and the triangle abc (c2). If the
+   * segment crosses the triangle, c1 = c2 is the crossing point.
+   */
+  static void closestSegmentTriangle(const Point & p,
+                                     const Point & q,
+                                     const Point & a,
+                                     const Point & b,
+                                     const Point & c,
+                                     Real & s,
+                                     Point & c1,
+                                     Point & c2);
+
+protected:
+  struct Box
+  {
+    Point min;
+    Point max;
+
+    void reset();
+    void extend(const Box & other);
+    bool overlaps(const Box & other) const;
+    Real surfaceArea() const;
+  };
+
+  struct Node
+  {
+    Box box;
+    /// Children of internal nodes, which always follow their parent in _nodes
+    unsigned int left;
+    unsigned int right;
+    /// Range of _order held by a leaf (count = 0 for internal nodes)
+    unsigned int first;
+    unsigned int count;
+  };
+
+  static Box primitiveBox(const Primitive & primitive, Real margin);
+
+  /// Builds the subtree over _order[first, first + count) and returns its node index
+  unsigned int buildNode(unsigned int first, unsigned int count);
+
+  /// Recomputes the boxes of all nodes from the primitive boxes
+  void refit();
+
+  /// Summed surface area of the internal node boxes
+  Real internalArea() const;
+
+  void selfPairs(unsigned int node, std::vector<PrimitivePair> & pairs) const;
+  void crossPairs(unsigned int a, unsigned int b, std::vector<PrimitivePair> & pairs) const;
+
+  /// Maximum number of primitives in a leaf
+  static const unsigned int _leaf_size = 4;
+
+  const Real _rebuild_ratio;
+  std::vector<Node> _nodes;
+  std::vector<unsigned int> _order;
+  std::vector<Box> _primitive_boxes;
+  Real _built_area;
+  unsigned int _builds;
+};
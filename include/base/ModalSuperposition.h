@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+
+/**
+ * Modal superposition for linear structural dynamics, M u'' + C u' + K u = f(t) with Rayleigh
+ * damping C = eta M + zeta K.
+ *
+ * With M-orthonormal modes, every modal coordinate obeys q'' + (eta + zeta omega^2) q' +
+ * omega^2 q = phi^T f. exactStep() returns the transition of (q, q') over a time step in which
+ * the modal load is linear, from the exponential of the augmented system, so a piecewise linear
+ * load history is integrated without time discretization error for any damping.
+ */
+class ModalSuperposition
+{
+public:
+  /// (q, q')_{n+1} = state (q, q')_n + load (f_n, f_{n+1})
+  struct Step
+  {
+    std::array<std::array<Real, 2>, 2> state;
+    std::array<std::array<Real, 2>, 2> load;
+  };
+
+  /// Exact step of q'' + damping q' + omega2 q = f for a load linear over the step
+  static Step exactStep(Real omega2, Real damping, Real dt);
+};
@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "PerfGuard.h"
+
+#include <new>
+#include <type_traits>
+
+class PerfGraph;
+
+/**
+ * Scope guard timing a PerfGraph section from objects that are evaluated on every thread
+ * (materials, kernels). The PerfGraph call stack is not thread safe, so only thread 0 records;
+ * with threads the section times are those of the first thread's share of the elements. The
+ * guard is constructed in place, so the hot paths pay no allocation.
+ */
+class ThreadedPerfGuard
+{
+public:
+  ThreadedPerfGuard(PerfGraph & graph, PerfID id, THREAD_ID tid) : _active(tid == 0)
+  {
+    if (_active)
+      new (&_storage) PerfGuard(graph, id);
+  }
+
+  ~ThreadedPerfGuard()
+  {
+    if (_active)
+      reinterpret_cast<PerfGuard *>(&_storage)->~PerfGuard();
+  }
+
+  ThreadedPerfGuard(const ThreadedPerfGuard &) = delete;
+  ThreadedPerfGuard & operator=(const ThreadedPerfGuard &) = delete;
+
+private:
+  const bool _active;
+  typename std::aligned_storage<sizeof(PerfGuard), alignof(PerfGuard)>::type _storage;
+};
+
+/// Times the rest of the enclosing scope under the section id, from a MooseObject with a _tid
+#define OTTER_TIME_SECTION(id)                                                                     \
+  ThreadedPerfGuard otter_time_section_guard(_app.perfGraph(), id, _tid)
@@ -0,0 +1,73 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "DiracKernel.h"
+#include "libmesh/tensor_value.h"
+
+#include <map>
+
+class BeamContactSearch;
+
+/**
+ * Penalty contact forces for the pairs found by BeamContactSearch: every penetrating pair pushes
+ * its two elements apart along the contact normal with penalty * penetration, applied at the
+ * contact point of either side (on the beam axis, so the contact does not load the beam
+ * rotations). One kernel per displacement component.
+ *
+ * The Jacobian holds the penalty stiffness within each element; the coupling between the two
+ * elements of a pair is not in the sparsity pattern, so use PJFNK (or Newton with a few more
+ * iterations) for contact dominated problems.
+ */
+class BeamContactPenalty : public DiracKernel
+{
+public:
+  static InputParameters validParams();
+
+  BeamContactPenalty(const InputParameters & parameters);
+
+  virtual void addPoints() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Contact load on one element: force along the unit normal, at point
+  struct Load
+  {
+    Point point;
+    Point normal;
+    Real force;
+  };
+
+  /// Adds the load if the element is local
+  void addLoad(dof_id_type elem_id, const Point & point, const Point & normal, Real force);
+
+  /// Sums the loads at the current point into _force and _normal_product
+  void updateCurrentLoads();
+
+  const BeamContactSearch & _search;
+  const Real _penalty;
+  const unsigned int _component;
+
+  /// Variable numbers of the displacements, for the off-diagonal Jacobian
+  std::vector<unsigned int> _disp_var;
+
+  std::map<const Elem *, std::vector<Load>> _loads;
+
+  /// Element and point the sums below are for
+  const Elem * _loads_elem;
+  Point _loads_point;
+
+  /// Summed force vector and summed n n^T of the loads at the current point
+  RealVectorValue _force;
+  RealTensorValue _normal_product;
+};
@@ -0,0 +1,94 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Executioner.h"
+#include "ModalSuperposition.h"
+
+#include "libmesh/numeric_vector.h"
+
+#include <memory>
+
+class Function;
+
+/**
+ * Transient executioner for linear elastic beam structures by modal superposition. The stiffness
+ * is the Jacobian of the system (the beam kernels and materials, e.g. StressDivergenceBeaml over
+ * ComputeIncrementalBeamStrainl) and the mass the matrix of the mass_matrix_tag (e.g. assembled
+ * by BeamLumpedMass), both assembled once at the start. The fixed degrees of freedom are
+ * eliminated, the n_modes modes nearest to the shift are extracted by a SLEPc shift-invert
+ * eigensolve, and the decoupled modal equations are integrated exactly for the nodal load history,
+ * which is sampled every dt and linear in between. Rayleigh damping C = eta M + zeta K only
+ * changes the modal damping.
+ *
+ * Every variable of the nonlinear system takes part in the modes, so the system must only hold
+ * the beam displacements and rotations, and the Jacobian must hold their coupling (full
+ * single matrix preconditioning). No nonlinear system is solved: the displacements and rotations
+ * are reconstructed from the modes only every output_interval steps, where the aux kernels, user
+ * objects and outputs run as at the end of a time step.
+ */
+class ModalBeamTransient : public Executioner
+{
+public:
+  static InputParameters validParams();
+
+  ModalBeamTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void execute() override;
+  virtual bool lastSolveConverged() const override { return true; }
+
+protected:
+  /// Assembles the stiffness and mass and extracts the M-orthonormal modes
+  void extractModes();
+
+  /// Degrees of freedom of the variables at the nodes on the boundaries owned by this rank
+  std::vector<dof_id_type> localBoundaryDofs(const std::vector<BoundaryName> & boundaries,
+                                             const std::vector<VariableName> & variables);
+
+  /// Modal loads at time t
+  void modalLoads(Real t, std::vector<Real> & loads) const;
+
+  /// Writes the modal superposition of the displacements and rotations into the solution
+  void reconstructSolution();
+
+  Real & _time;
+  Real & _time_old;
+  int & _time_step;
+  Real & _problem_dt;
+
+  const unsigned int _n_modes;
+  const Real _shift;
+  const Real _eta;
+  const Real _zeta;
+  const Real _dt;
+  const Real _start_time;
+  const Real _end_time;
+  const unsigned int _output_interval;
+
+  /// Load functions and, for every load, the degrees of freedom of this rank it acts on
+  std::vector<const Function *> _load_functions;
+  std::vector<std::vector<dof_id_type>> _load_dofs;
+
+  /// Eigenvalues omega^2, M-orthonormal modes and the exact step of every mode
+  std::vector<Real> _omega2;
+  std::vector<std::unique_ptr<NumericVector<Number>>> _modes;
+  std::vector<ModalSuperposition::Step> _steps;
+
+  /// Modal participation of every load, [load][mode]
+  std::vector<std::vector<Real>> _participation;
+
+  /// Modal displacements and velocities
+  std::vector<Real> _q;
+  std::vector<Real> _q_dot;
+
+  const PerfID _init_timer;
+  const PerfID _integrate_timer;
+};
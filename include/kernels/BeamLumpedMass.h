@@ -0,0 +1,57 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Kernel.h"
+#include "RankTwoTensorForward.h"
+
+/**
+ * Lumped mass of a two node beam element: half of the translational mass rho A L and half of the
+ * rotary inertia at each node, the rotary inertia in the beam local axes of
+ * ComputeIncrementalBeamStrainl. The kernel only adds the mass to the Jacobian of its matrix tags
+ * (the "mass" tag by default), for solvers that need the mass matrix itself, such as the
+ * eigensolve of ModalBeamTransient; it contributes no residual.
+ */
+class BeamLumpedMass : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  BeamLumpedMass(const InputParameters & parameters);
+
+  virtual void computeResidual() override {}
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+protected:
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// Nodal mass coupling this component to coupled_component
+  Real nodalMass(unsigned int coupled_component) const;
+
+  /// Direction of the variable (0-2 for the displacements, 3-5 for the rotations)
+  const unsigned int _component;
+
+  /// Variable numbers of the rotations
+  std::vector<unsigned int> _rot_var;
+
+  const MaterialProperty<Real> & _density;
+
+  /// Section properties
+  const VariableValue & _area;
+  const VariableValue & _Iy;
+  const VariableValue & _Iz;
+  const bool _has_Ix;
+  const VariableValue & _Ix;
+
+  /// Initial length and rotation from global to beam local coordinates
+  const MaterialProperty<Real> & _original_length;
+  const MaterialProperty<RankTwoTensor> & _initial_rotation;
+};
@@ -111,15 +111,12 @@ protected:
   /// Residual corresponding to rotational DOFs at the nodes in global coordinate system
   std::vector<RealVectorValue> _global_moment_res;
 
-  /// Forces at each Qp in the beam local configuration
-  std::vector<RealVectorValue> _force_local_t;
-
-  /// Moments at each Qp in the beam local configuration
-  std::vector<RealVectorValue> _moment_local_t;
-
   /// Residual corresponding to displacement DOFs at the nodes in beam local coordinate system
   std::vector<RealVectorValue> _local_force_res;
 
   /// Residual corresponding to rotational DOFs at the nodes in beam local coordinate system
   std::vector<RealVectorValue> _local_moment_res;
+
+  /// PerfGraph section timing computeGlobalResidual
+  const PerfID _compute_global_residual_timer;
 };
@@ -10,6 +10,11 @@
 #pragma once
 
 #include "RadialReturnStressUpdate.h"
+#include "RadialReturnPointModels.h"
+#include "CycleJumpRecord.h"
+#include "TimeStepLimit.h"
+
+class CycleJump;
 
 /**
  * This class uses the Discrete material in a radial return Kinematic plasticity
@@ -50,17 +55,16 @@ protected:
                          bool compute_full_tangent_operator,
                          RankFourTensor & tangent_operator) override;
 
-  virtual void computeStressInitialize(const Real & effective_trial_stress,
-                                       const RankFourTensor & elasticity_tensor) override;
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeReferenceResidual(const Real & effective_trial_stress, const Real & scalar_effective_inelastic_strain) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
-  virtual void iterationFinalize(Real scalar) override;
   virtual void computeStressFinalize(const RankTwoTensor & plastic_strain_increment) override;
 
   virtual Real computeTimeStepLimit() override;
   virtual Real computeEffectiveStress(RankTwoTensor stress);
-  virtual Real computeEffectiveStrain(RankTwoTensor strain);
+
+  /// Point integration of this model, shared with the material point driver of the unit app
+  Bilin1Point point() const;
 
 
   /// a string to prepend to the plastic strain Material Property name
@@ -71,13 +75,6 @@ protected:
   const Real _det_constant;
   const Real _peak_strength;
 
-  Real _yield_condition;
-  Real _hardening_slope;
-
-  /// yield stress used in each plstic iteration
-  MaterialProperty<Real> & _yield;
-  const MaterialProperty<Real> & _yield_old;
-
   /// plastic strain in this model
   MaterialProperty<RankTwoTensor> & _plastic_strain;
 
@@ -91,62 +88,45 @@ protected:
 
   Real _youngs_modulus;
 
-  /// backstress tensor
-  MaterialProperty<RankTwoTensor> & _back_stress;
-  const MaterialProperty<RankTwoTensor> & _back_stress_old;
-
-  /// backstress for when strength limit is reached
-  MaterialProperty<RankTwoTensor> & _back_test;
-  const MaterialProperty<RankTwoTensor> & _back_test_old;
-
-  /// backstress for deteriorating part of response
-  MaterialProperty<RankTwoTensor> & _det_back_stress;
-  const MaterialProperty<RankTwoTensor> & _det_back_stress_old;
-
-
-  MaterialProperty<RankTwoTensor> & _effective_stress;
-  const MaterialProperty<RankTwoTensor> & _effective_stress_old;
-  const MaterialProperty<Real> & _effective_inelastic_strain_older;
-
-  Real input_dt;
-  Real old;
-  Real s_new;
-  Real effective_strain;
-  Real effective_strain_old;
-  Real strain_dir;
-  Real strain_dir_old;
-  Real incremental_strain;
-
-  MaterialProperty<bool> & _damage;
-  const MaterialProperty<bool> & _damage_old;
-
-  Real direction;
-
-  /// flag to check if positive or negative side has deteriorated
-  MaterialProperty<bool> & _damagepos;
-  const MaterialProperty<bool> & _damagepos_old;
-  MaterialProperty<bool> & _damageneg;
-  const MaterialProperty<bool> & _damageneg_old;
-
-  /// strength limits
-  MaterialProperty<Real> & _maxpos;
-  const MaterialProperty<Real> & _maxpos_old;
-  MaterialProperty<Real> & _maxneg;
-  const MaterialProperty<Real> & _maxneg_old;
-
-  /// strain limits
-  MaterialProperty<Real> & _strain_max;
-  const MaterialProperty<Real> & _strain_max_old;
-  MaterialProperty<Real> & _strain_min;
-  const MaterialProperty<Real> & _strain_min_old;
-  MaterialProperty<Real> & _th_pos;
-  const MaterialProperty<Real> & _th_pos_old;
-  MaterialProperty<Real> & _th_neg;
-  const MaterialProperty<Real> & _th_neg_old;
-
-  /// flag for if strength limit occurs before yield surface
-  MaterialProperty<bool> & _istestpos;
-  const MaterialProperty<bool> & _istestpos_old;
-  MaterialProperty<bool> & _istestneg;
-  const MaterialProperty<bool> & _istestneg_old;
+  typedef Bilin1Point::State State;
+
+  /// backstresses, damage flags, yield, strength and strain limits packed into one record
+  MaterialProperty<State> & _state;
+  const MaterialProperty<State> & _state_old;
+
+  typedef Bilin1Point::StepState StepState;
+
+  /// Adaptive substepping controls
+  const bool _use_substepping;
+  const Real _substep_tolerance;
+  const unsigned int _max_substeps;
+
+  /// Flow direction, trial stress, increment and hardening modulus of the last return map
+  RadialReturnCore::ReturnData _return_data;
+
+  /// Cycle jump controller, nullptr when every load cycle is resolved
+  const CycleJump * const _cycle_jump;
+
+  typedef CycleJumpRecord<State> CycleRecord;
+
+  /// Internal state history over the load cycles, only declared with a cycle jump controller
+  MaterialProperty<CycleRecord> * _cycle_record;
+  const MaterialProperty<CycleRecord> * _cycle_record_old;
+  MaterialProperty<Real> * _cycle_rate_change;
+
+  /// Return map evaluations (over all substeps) and plastic flag of the step, for the counters
+  MaterialProperty<Real> & _return_map_iterations;
+  MaterialProperty<Real> & _plastic_active;
+  unsigned int _iterations;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+
+  /// Effective stresses of the step against the yield stress and the peak strength
+  TimeStepLimit::Transition _yield_transition;
+  TimeStepLimit::Transition _peak_transition;
+
+  /// PerfGraph section timing updateState
+  const PerfID _update_state_timer;
 };
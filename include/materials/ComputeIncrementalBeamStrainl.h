@@ -11,6 +11,7 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "ElementUpdateCache.h"
 
 // Forward Declarations
 class Function;
@@ -31,6 +32,9 @@ public:
 protected:
   virtual void initQpStatefulProperties() override;
 
+  /// Computes the element-constant gradients of the nodal increments in the beam local frame
+  void computeLocalGradients();
+
   /// Computes the displacement and rotation strain increments
   void computeQpStrain();
 
@@ -170,4 +174,10 @@ protected:
 
   /// Prefactor function to multiply the elasticity tensor with
   const Function * const _prefactor_function;
+
+  /// Reuse of the outputs of elements whose nodal increments did not change, null if disabled
+  std::unique_ptr<ElementUpdateCache> _update_cache;
+
+  /// Increments of the 12 nodal degrees of freedom of the current element, the cache key
+  std::vector<Real> _dof_increments;
 };
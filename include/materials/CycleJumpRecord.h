@@ -0,0 +1,118 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "RankTwoTensor.h"
+
+#include <algorithm>
+
+/**
+ * Per qp history used by the cycle jump of the radial return models. It holds the packed internal
+ * state, the accumulated effective plastic strain and the plastic strain tensor at the end of the
+ * last resolved load cycle, together with their increments over that cycle. Once the increments
+ * of consecutive cycles agree (rate_change below the tolerance of the CycleJump controller) the
+ * state at the start of the next cycle is extrapolated linearly over the jumped cycles.
+ *
+ * Only cumulative quantities are extrapolated: the plastic strains here, and the slots of the
+ * internal state the model selects (back stresses, hardening variables, strength excursions,
+ * clamped to their bounds). Thresholds and per step values of the state are kept. The total
+ * strain is a solution quantity the material cannot extrapolate, so the models take the jumped
+ * plastic strain out of the start of step elastic strain (and stress) and report it as inelastic
+ * strain of the step. The total, elastic and plastic strains stay consistent, and the solve of
+ * that step, started from the displacements CycleJumpPredictor extrapolates, recovers the stress
+ * by moving the total strain by the ratcheting of the jumped cycles. State must provide add() and
+ * relativeChange() as PackedPlasticityState does.
+ */
+template <typename State>
+struct CycleJumpRecord
+{
+  /// Starts a record at the initial state
+  void
+  init(const State & state, Real effective_plastic_strain, const RankTwoTensor & plastic_strain)
+  {
+    snapshot = state;
+    increment.zero();
+    effective_plastic_strain_snapshot = effective_plastic_strain;
+    effective_plastic_strain_increment = 0.0;
+    plastic_strain_snapshot = plastic_strain;
+    plastic_strain_increment.zero();
+    rate_change = 1.0;
+    cycles_recorded = 0;
+  }
+
+  /**
+   * Copies the record from the start of the step and, if cycles are jumped at this step,
+   * extrapolates the start of step plastic strains by num_cycles increments and the internal state
+   * with extrapolate(State & state, const State & increment, Real num_cycles). Returns the jumped
+   * plastic strain, zero without a jump.
+   */
+  template <typename Extrapolate>
+  RankTwoTensor beginStep(const CycleJumpRecord & old,
+                 unsigned int num_cycles,
+                 State & state,
+                 Real & effective_plastic_strain,
+                 RankTwoTensor & plastic_strain,
+                 const Extrapolate & extrapolate)
+  {
+    *this = old;
+    if (num_cycles == 0 || cycles_recorded == 0)
+      return RankTwoTensor();
+
+    const Real cycles = num_cycles;
+    const RankTwoTensor jumped_plastic_strain = cycles * plastic_strain_increment;
+    extrapolate(state, increment, cycles);
+    effective_plastic_strain += cycles * std::max(effective_plastic_strain_increment, 0.0);
+    plastic_strain += jumped_plastic_strain;
+
+    snapshot = state;
+    effective_plastic_strain_snapshot = effective_plastic_strain;
+    plastic_strain_snapshot = plastic_strain;
+    return jumped_plastic_strain;
+  }
+
+  /// Closes a resolved cycle at the end of step state and updates the rate change
+  void closeCycle(const State & state,
+                  Real effective_plastic_strain,
+                  const RankTwoTensor & plastic_strain,
+                  Real floor)
+  {
+    State new_increment = state;
+    new_increment.add(snapshot, -1.0);
+    const Real new_plastic_strain_increment =
+        effective_plastic_strain - effective_plastic_strain_snapshot;
+
+    if (cycles_recorded > 0)
+      rate_change = std::max(new_increment.relativeChange(increment, state, floor),
+                             State::componentChange(new_plastic_strain_increment,
+                                                    effective_plastic_strain_increment,
+                                                    effective_plastic_strain,
+                                                    floor));
+
+    increment = new_increment;
+    effective_plastic_strain_increment = new_plastic_strain_increment;
+    plastic_strain_increment = plastic_strain - plastic_strain_snapshot;
+    snapshot = state;
+    effective_plastic_strain_snapshot = effective_plastic_strain;
+    plastic_strain_snapshot = plastic_strain;
+    cycles_recorded = std::min(cycles_recorded + 1, 2u);
+  }
+
+  State snapshot;
+  State increment;
+  Real effective_plastic_strain_snapshot;
+  Real effective_plastic_strain_increment;
+  RankTwoTensor plastic_strain_snapshot;
+  RankTwoTensor plastic_strain_increment;
+
+  /// Relative change between the increments of the last two resolved cycles (1 until known)
+  Real rate_change;
+  unsigned int cycles_recorded;
+};
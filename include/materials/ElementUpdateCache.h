@@ -0,0 +1,293 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InputParameters.h"
+#include "MaterialProperty.h"
+#include "RankTwoTensor.h"
+
+#include "libmesh/elem.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Per element cache of the outputs of a beam material, keyed on the time, the increments of the
+ * nodal degrees of freedom the material gathers for the element and the values of every other
+ * input that can change within a step (eigenstrains, elastic properties, coupled section
+ * variables), registered as dependencies. An element evaluated again with an unchanged key, as in
+ * the residual and Jacobian at the same iterate or away from where the solution changes, has the
+ * outputs of its previous evaluation restored instead of repeating the return maps and the
+ * stiffness assembly.
+ *
+ * Every property the material writes is registered, stateful ones included, so a restored element
+ * is indistinguishable from a recomputed one. Properties only computed for the Jacobian form a
+ * separate group: a residual evaluation reuses a Jacobian one but not the reverse. Material
+ * objects are owned by a single thread, so the cache needs no locking.
+ *
+ * The cache holds a copy of the registered properties of every element evaluated at the current
+ * time, the stiffness blocks and layer states included, so it is opt-in; the entries of earlier
+ * times can never be reused and are dropped when the time changes.
+ */
+class ElementUpdateCache
+{
+public:
+  /// Parameters switching the reuse on and setting its tolerance
+  static void addParams(InputParameters & params)
+  {
+    params.addParam<bool>("reuse_unchanged_elements",
+                          false,
+                          "Reuse the outputs of the previous evaluation of an element when its "
+                          "nodal increments, its other inputs and the time did not change. Keeps "
+                          "a copy of the material outputs of every element for the current time.");
+    params.addRangeCheckedParam<Real>(
+        "reuse_tolerance",
+        0.0,
+        "reuse_tolerance >= 0",
+        "Relative change of every nodal increment below which an element is reused; zero only "
+        "reuses identical increments");
+  }
+
+  explicit ElementUpdateCache(Real tolerance) : _tolerance(tolerance) {}
+
+  /// Registers a property written by the material, computed for the Jacobian only if jacobian
+  template <typename T>
+  void add(MaterialProperty<T> & property, bool jacobian = false)
+  {
+    (jacobian ? _jacobian_slots : _slots).emplace_back(new PropertySlot<T>(property));
+  }
+
+  /// Registers an input read at every qp, a material property or a coupled variable value
+  template <typename T>
+  void addDependency(const T & values)
+  {
+    _dependencies.emplace_back(new DependencySlot<T>(values));
+  }
+
+  /**
+   * Restores the outputs of elem if its last evaluation was at time with the same increments and
+   * dependencies and, when jacobian is set, included the Jacobian outputs. Returns whether they
+   * were restored.
+   */
+  bool restore(const Elem & elem,
+               Real time,
+               const std::vector<Real> & increments,
+               unsigned int n_qp,
+               bool jacobian)
+  {
+    if (time != _time)
+    {
+      _entries.clear();
+      _time = time;
+    }
+
+    const auto it = _entries.find(elem.id());
+    if (it == _entries.end())
+      return false;
+
+    const Entry & entry = it->second;
+    if (entry.n_qp != n_qp || (jacobian && !entry.has_jacobian))
+      return false;
+    buildKey(increments, n_qp);
+    if (!unchanged(entry.key, _key))
+      return false;
+
+    unpack(_slots, n_qp, entry.values);
+    if (jacobian)
+      unpack(_jacobian_slots, n_qp, entry.jacobian_values);
+    return true;
+  }
+
+  /// Saves the outputs of the evaluation of elem at time just completed
+  void store(const Elem & elem,
+             Real time,
+             const std::vector<Real> & increments,
+             unsigned int n_qp,
+             bool jacobian)
+  {
+    if (time != _time)
+    {
+      _entries.clear();
+      _time = time;
+    }
+
+    Entry & entry = _entries[elem.id()];
+    entry.n_qp = n_qp;
+    buildKey(increments, n_qp);
+    entry.key = _key;
+    pack(_slots, n_qp, entry.values);
+    entry.has_jacobian = jacobian;
+    if (jacobian)
+      pack(_jacobian_slots, n_qp, entry.jacobian_values);
+  }
+
+protected:
+  /// Copies the values of a property at all qps to and from a flat array
+  struct Slot
+  {
+    virtual ~Slot() = default;
+    virtual void pack(unsigned int n_qp, std::vector<Real> & data) const = 0;
+    virtual const Real * unpack(unsigned int n_qp, const Real * data) = 0;
+  };
+
+  template <typename T>
+  struct PropertySlot : public Slot
+  {
+    explicit PropertySlot(MaterialProperty<T> & property) : _property(property) {}
+
+    virtual void pack(unsigned int n_qp, std::vector<Real> & data) const override
+    {
+      for (unsigned int qp = 0; qp < n_qp; ++qp)
+        packValue(_property[qp], data);
+    }
+
+    virtual const Real * unpack(unsigned int n_qp, const Real * data) override
+    {
+      for (unsigned int qp = 0; qp < n_qp; ++qp)
+        data = unpackValue(data, _property[qp]);
+      return data;
+    }
+
+    MaterialProperty<T> & _property;
+  };
+
+  /// Appends the values of an input at all qps to the key
+  struct Dependency
+  {
+    virtual ~Dependency() = default;
+    virtual void pack(unsigned int n_qp, std::vector<Real> & data) const = 0;
+  };
+
+  template <typename T>
+  struct DependencySlot : public Dependency
+  {
+    explicit DependencySlot(const T & values) : _values(values) {}
+
+    virtual void pack(unsigned int n_qp, std::vector<Real> & data) const override
+    {
+      for (unsigned int qp = 0; qp < n_qp; ++qp)
+        packValue(_values[qp], data);
+    }
+
+    const T & _values;
+  };
+
+  static void packValue(const Real & value, std::vector<Real> & data) { data.push_back(value); }
+
+  static void packValue(const RealVectorValue & value, std::vector<Real> & data)
+  {
+    for (unsigned int i = 0; i < LIBMESH_DIM; ++i)
+      data.push_back(value(i));
+  }
+
+  static void packValue(const RankTwoTensor & value, std::vector<Real> & data)
+  {
+    for (unsigned int i = 0; i < LIBMESH_DIM; ++i)
+      for (unsigned int j = 0; j < LIBMESH_DIM; ++j)
+        data.push_back(value(i, j));
+  }
+
+  static void packValue(const std::vector<Real> & value, std::vector<Real> & data)
+  {
+    data.push_back(value.size());
+    data.insert(data.end(), value.begin(), value.end());
+  }
+
+  static const Real * unpackValue(const Real * data, Real & value)
+  {
+    value = *data;
+    return data + 1;
+  }
+
+  static const Real * unpackValue(const Real * data, RealVectorValue & value)
+  {
+    for (unsigned int i = 0; i < LIBMESH_DIM; ++i)
+      value(i) = *data++;
+    return data;
+  }
+
+  static const Real * unpackValue(const Real * data, RankTwoTensor & value)
+  {
+    for (unsigned int i = 0; i < LIBMESH_DIM; ++i)
+      for (unsigned int j = 0; j < LIBMESH_DIM; ++j)
+        value(i, j) = *data++;
+    return data;
+  }
+
+  static const Real * unpackValue(const Real * data, std::vector<Real> & value)
+  {
+    const std::size_t size = static_cast<std::size_t>(*data++);
+    value.assign(data, data + size);
+    return data + size;
+  }
+
+  typedef std::vector<std::unique_ptr<Slot>> Slots;
+
+  static void pack(const Slots & slots, unsigned int n_qp, std::vector<Real> & data)
+  {
+    data.clear();
+    for (const auto & slot : slots)
+      slot->pack(n_qp, data);
+  }
+
+  static void unpack(Slots & slots, unsigned int n_qp, const std::vector<Real> & data)
+  {
+    const Real * position = data.data();
+    for (auto & slot : slots)
+      position = slot->unpack(n_qp, position);
+  }
+
+  /// Fills the key with the increments followed by the dependencies at all qps
+  void buildKey(const std::vector<Real> & increments, unsigned int n_qp)
+  {
+    _key = increments;
+    for (const auto & dependency : _dependencies)
+      dependency->pack(n_qp, _key);
+  }
+
+  /// Whether every key value is within the relative tolerance of its cached value
+  bool unchanged(const std::vector<Real> & cached, const std::vector<Real> & key) const
+  {
+    if (cached.size() != key.size())
+      return false;
+    for (std::size_t i = 0; i < cached.size(); ++i)
+      if (std::abs(key[i] - cached[i]) > _tolerance * std::abs(cached[i]))
+        return false;
+    return true;
+  }
+
+  struct Entry
+  {
+    unsigned int n_qp = 0;
+    bool has_jacobian = false;
+    std::vector<Real> key;
+    std::vector<Real> values;
+    std::vector<Real> jacobian_values;
+  };
+
+  const Real _tolerance;
+
+  /// Properties written at every evaluation and only for the Jacobian
+  Slots _slots;
+  Slots _jacobian_slots;
+
+  /// Inputs other than the nodal increments the outputs depend on
+  std::vector<std::unique_ptr<Dependency>> _dependencies;
+
+  /// Key of the element being evaluated
+  std::vector<Real> _key;
+
+  /// Time of the cached evaluations and the last evaluation of every element seen by this thread
+  Real _time = std::numeric_limits<Real>::quiet_NaN();
+  std::unordered_map<dof_id_type, Entry> _entries;
+};
@@ -10,6 +10,8 @@
 #pragma once
 
 #include "RadialReturnStressUpdate.h"
+#include "RadialReturnPointModels.h"
+#include "TimeStepLimit.h"
 
 /**
  * This class uses the Discrete material in a radial return Kinematic plasticity
@@ -50,16 +52,26 @@ protected:
                          bool compute_full_tangent_operator,
                          RankFourTensor & tangent_operator) override;
 
-  virtual void computeStressInitialize(const Real & effective_trial_stress,
-                                       const RankFourTensor & elasticity_tensor) override;
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeReferenceResidual(const Real & effective_trial_stress, const Real & scalar_effective_inelastic_strain) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
-  virtual void iterationFinalize(Real scalar) override;
   virtual void computeStressFinalize(const RankTwoTensor & plastic_strain_increment) override;
+  virtual Real computeTimeStepLimit() override;
 
   virtual void computeYieldStress(const RankFourTensor & elasticity_tensor);
-  virtual Real computeHardeningDerivative(Real scalar);
+
+  /// The packed state of the point model holds the back stress only
+  typedef KinematicPlasticityPoint<RadialReturnCore::LinearHardening>::StepState StepState;
+  static const unsigned int BACK_STRESS =
+      KinematicPlasticityPoint<RadialReturnCore::LinearHardening>::BACK_STRESS;
+
+  /// Integrates the step with the point model for the given back stress law
+  template <typename KinematicLaw>
+  void integrate(const KinematicLaw & kinematic,
+                 const StepState & start,
+                 const RankTwoTensor & strain_increment,
+                 const RankFourTensor & elasticity_tensor,
+                 StepState & end);
 
   /// a string to prepend to the plastic strain Material Property name
   const std::string _plastic_prepend;
@@ -69,8 +81,9 @@ protected:
   const Real _hardening_constant;
   const Function * const _hardening_function;
 
-  Real _yield_condition;
-  Real _hardening_slope;
+  /// Tolerances of the Newton return for a hardening function
+  const Real _relative_tolerance;
+  const Real _absolute_tolerance;
 
   /// plastic strain in this model
   MaterialProperty<RankTwoTensor> & _plastic_strain;
@@ -83,4 +96,22 @@ protected:
   MaterialProperty<RankTwoTensor> & _back_stress;
   const MaterialProperty<RankTwoTensor> & _back_stress_old;
   const VariableValue & _temperature;
+
+  /// Flow direction, trial stress, increment and hardening modulus of the last return map
+  RadialReturnCore::ReturnData _return_data;
+
+  /// Return map evaluations (over all substeps) and plastic flag of the step, for the counters
+  MaterialProperty<Real> & _return_map_iterations;
+  MaterialProperty<Real> & _plastic_active;
+  unsigned int _iterations;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+
+  /// Effective stress of the step against the yield stress
+  TimeStepLimit::Transition _yield_transition;
+
+  /// PerfGraph section timing updateState
+  const PerfID _update_state_timer;
 };
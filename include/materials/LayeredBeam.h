@@ -11,6 +11,7 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "ElementUpdateCache.h"
 
 /**
  * LayeredBeam defines a displacement and rotation strain increment and rotation
@@ -33,6 +34,21 @@ public:
 
   virtual void computeProperties() override;
 
+  /**
+   * Through-thickness integration points over [-1, 1] and their weights. Returns false if n
+   * points are not valid for the rule.
+   */
+  static bool throughThicknessRule(const MooseEnum & rule,
+                                   unsigned int n,
+                                   std::vector<Real> & points,
+                                   std::vector<Real> & weights);
+
+  /// Number of points a rule needs, for error messages
+  static std::string thicknessRuleRequirement(const MooseEnum & rule);
+
+  /// Position of the stress of a layer in the layer state, empty while the section is elastic
+  static unsigned int stressIndex(unsigned int layer) { return 3 * layer; }
+
 protected:
   virtual void initQpStatefulProperties() override;
 
@@ -45,10 +61,18 @@ protected:
   /// Computes the rotation matrix at time t. For small rotation scenarios, the rotation matrix at time t is same as the intiial rotation matrix
   virtual void computeRotation();
 
-  //
+  /**
+   * Computes the moment from the curvature increment. An element starts as an elastic section
+   * with the closed form moment-curvature relation and is only integrated layer by layer once
+   * the extreme fiber yields; the layers then start from the linear elastic stress distribution.
+   */
   void computeQpStress();
-  virtual Real computeHardeningValue(Real scalar, Real j);
-  virtual Real computeHardeningDerivative(Real scalar, Real j);
+  virtual Real computeHardeningValue(Real scalar, unsigned int layer);
+  virtual Real computeHardeningDerivative(Real scalar, unsigned int layer);
+
+  /// Positions of the plastic strain and hardening variable of a layer in the layer state
+  static unsigned int plasticStrainIndex(unsigned int layer) { return 3 * layer + 1; }
+  static unsigned int hardeningIndex(unsigned int layer) { return 3 * layer + 2; }
 
 
   /// Booleans for validity of params
@@ -60,7 +84,7 @@ protected:
   /// Number of coupled displacement variables
   unsigned int _ndisp;
 
-  /// number of x-sec layers to consider
+  /// number of x-sec layers (through-thickness integration points) to consider
   unsigned int _nlayers;
 
   /// Variable numbers corresponding to the rotational variables
@@ -202,19 +226,54 @@ protected:
   MaterialProperty<Real> & _total_stretch;
   const MaterialProperty<Real> & _total_stretch_old;
 
-  /// basically, instead of material property that is a vector
-  /// we're creating a vector of material properties
-  std::vector<MaterialProperty<Real> *> _direct_stress;
-  std::vector<const MaterialProperty<Real> *> _direct_stress_old;
-  std::vector<MaterialProperty<Real> *> _plastic_strain;
-  std::vector<const MaterialProperty<Real> *> _plastic_strain_old;
+  /// Start every element as an elastic section (false integrates all layers from the start)
+  const bool _adaptive_layering;
+
+  /// Through-thickness position and weight (width times thickness share) of every layer
+  std::vector<Real> _layer_z;
+  std::vector<Real> _layer_weight;
+
+  /// Second moment of area of the layers and largest fiber distance, for the elastic section
+  Real _section_inertia;
+  Real _extreme_z;
+
+  /**
+   * Stress, plastic strain and hardening variable of every layer. Empty while the section is
+   * elastic, so that the layer storage only grows with the plastic zone.
+   */
+  MaterialProperty<std::vector<Real>> & _layer_state;
+  const MaterialProperty<std::vector<Real>> & _layer_state_old;
+
+  /// Layer state at the start of the step, in the old property or the elastic distribution
+  const std::vector<Real> * _layer_start;
+  std::vector<Real> _elastic_layers;
+
   MaterialProperty<Real> & _stres;
   const MaterialProperty<Real> & _stres_old;
   const MaterialProperty<RealVectorValue> & _moment_old;
   const MaterialProperty<RealVectorValue> & _material_flexure;
-  std::vector<MaterialProperty<Real> *> _hardening_variable;
-  std::vector<const MaterialProperty<Real> *> _hardening_variable_old;
 
   /// maximum no. of iterations
   const unsigned int _max_its;
+
+  /// Number of yielding layers and return map iterations summed over the layers, for the counters
+  MaterialProperty<Real> & _layers_in_yield;
+  MaterialProperty<Real> & _return_map_iterations;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+  const Real _max_plastic_increment_ratio;
+
+  /// Largest next time step estimated from the plastic increment, the iterations and first yield
+  MaterialProperty<Real> & _matl_timestep_limit;
+
+  /// Reuse of the outputs of elements whose nodal increments did not change, null if disabled
+  std::unique_ptr<ElementUpdateCache> _update_cache;
+
+  /// Increments of the 12 nodal degrees of freedom of the current element, the cache key
+  std::vector<Real> _dof_increments;
+
+  /// PerfGraph section timing computeQpStress
+  const PerfID _compute_qp_stress_timer;
 };
@@ -87,4 +87,12 @@ protected:
 
   /// maximum no. of iterations
   const unsigned int _max_its;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+  const Real _max_plastic_increment_ratio;
+
+  /// Largest next time step estimated from the plastic increment, the iterations and first yield
+  MaterialProperty<Real> & _matl_timestep_limit;
 };
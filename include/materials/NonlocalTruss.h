@@ -27,8 +27,21 @@ protected:
   virtual void initQpStatefulProperties();
 
   virtual void computeNonlocalVars();
-  virtual std::vector<Real> computeNonlocalStress(DenseMatrix<Real> t1,DenseMatrix<Real> waw,DenseVector<Real> _lambda, std::vector<MaterialProperty<Real> *> wt, DenseMatrix<Real> A);
-  // virtual std::vector<Real> computeNonlocalStress(DenseMatrix<Real> t1,DenseMatrix<Real> waw,DenseVector<Real> _lambda, std::vector<Real> _w, DenseMatrix<Real> A);
+
+  /**
+   * Nonlocal return map. With active_set, the plastic multipliers are only solved for on the
+   * yielding points and the points within active_set_cutoff of them; the set grows whenever
+   * another point yields, and the reduced system is refactorized only then. Returns the local
+   * plastic strains.
+   */
+  virtual const std::vector<Real> & computeNonlocalStress(const DenseMatrix<Real> & waw,
+                                                          const DenseMatrix<Real> & A);
+
+  /// Entry (i, j) of the return map system
+  Real systemEntry(unsigned int i, unsigned int j) const;
+
+  /// Adds the neighborhoods of the newly yielding points to the active set; returns whether it grew
+  bool growActiveSet();
 
   //  yield stress and hardening property input
   Real _yield_stress;
@@ -79,7 +92,6 @@ protected:
   DenseVector<Real> _t2;
   DenseMatrix<Real> _waw;
   DenseMatrix<Real> _aw;
-  DenseMatrix<Real> _wawaw;
 
 
 
@@ -88,4 +100,32 @@ protected:
 
   /// maximum no. of iterations
   const unsigned int _max_its;
+
+  /// Whether the return map is restricted to the active set, and its neighborhood distance
+  const bool _active_set;
+  const Real _active_set_cutoff;
+
+  /// Active points, membership flags, yielded flags and the system on the active points
+  std::vector<unsigned int> _active;
+  std::vector<bool> _is_active;
+  std::vector<bool> _yielded;
+  DenseMatrix<Real> _t1_active;
+
+  /// Points with nonzero local plastic strain
+  std::vector<unsigned int> _plastic_points;
+
+  /// Iterations of the last nonlocal return map
+  unsigned int _nonlocal_iterations;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+  const Real _max_plastic_increment_ratio;
+
+  /// Largest next time step estimated from the plastic increment, the iterations and first yield
+  MaterialProperty<Real> & _matl_timestep_limit;
+
+  /// PerfGraph sections timing the nonlocal averaging and the nonlocal return
+  const PerfID _compute_nonlocal_vars_timer;
+  const PerfID _compute_nonlocal_stress_timer;
 };
@@ -0,0 +1,129 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "RankTwoTensor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Per qp internal state of the radial return models packed into a single stateful material
+ * property. Symmetric tensors (back stresses, effective stress) are kept as their six Voigt
+ * components (xx, yy, zz, yz, xz, xy), boolean flags share one bitfield and scalar limits live in
+ * a fixed size array. The record is trivially copyable, so resetting the current state from the
+ * old one is a single block copy and the generic binary dataStore/dataLoad handle restart.
+ */
+template <unsigned int NTensors, unsigned int NLimits>
+class PackedPlasticityState
+{
+public:
+  PackedPlasticityState() { zero(); }
+
+  /// Sets all tensors, flags and limits to zero
+  void zero()
+  {
+    _voigt.fill(0.0);
+    _limits.fill(0.0);
+    _flags = 0;
+  }
+
+  /// Unpacks the i-th symmetric tensor
+  RankTwoTensor tensor(unsigned int i) const
+  {
+    const Real * v = &_voigt[6 * i];
+    return RankTwoTensor(v[0], v[1], v[2], v[3], v[4], v[5]);
+  }
+
+  /// Packs a symmetric tensor into the i-th slot
+  void setTensor(unsigned int i, const RankTwoTensor & t)
+  {
+    Real * v = &_voigt[6 * i];
+    v[0] = t(0, 0);
+    v[1] = t(1, 1);
+    v[2] = t(2, 2);
+    v[3] = 0.5 * (t(1, 2) + t(2, 1));
+    v[4] = 0.5 * (t(0, 2) + t(2, 0));
+    v[5] = 0.5 * (t(0, 1) + t(1, 0));
+  }
+
+  void zeroTensor(unsigned int i) { std::fill_n(&_voigt[6 * i], 6, 0.0); }
+
+  /// Adds scale times the i-th tensor of other to the i-th tensor
+  void addTensor(unsigned int i, const PackedPlasticityState & other, Real scale)
+  {
+    for (unsigned int j = 6 * i; j < 6 * i + 6; ++j)
+      _voigt[j] += scale * other._voigt[j];
+  }
+
+  bool flag(unsigned int i) const { return (_flags >> i) & 1u; }
+
+  void setFlag(unsigned int i, bool value)
+  {
+    if (value)
+      _flags |= (1u << i);
+    else
+      _flags &= ~(1u << i);
+  }
+
+  Real & limit(unsigned int i) { return _limits[i]; }
+  const Real & limit(unsigned int i) const { return _limits[i]; }
+
+  /**
+   * Adds scale times the tensors and limits of other; the flags are left unchanged. Used for
+   * differences of whole states; extrapolations pick the cumulative slots with addTensor()
+   */
+  void add(const PackedPlasticityState & other, Real scale)
+  {
+    for (unsigned int i = 0; i < _voigt.size(); ++i)
+      _voigt[i] += scale * other._voigt[i];
+    for (unsigned int i = 0; i < _limits.size(); ++i)
+      _limits[i] += scale * other._limits[i];
+  }
+
+  /**
+   * Largest change between the tensor and limit components of this and other, relative to the
+   * component of this or to floor times the component of reference, whichever is larger
+   */
+  Real relativeChange(const PackedPlasticityState & other,
+                      const PackedPlasticityState & reference,
+                      Real floor) const
+  {
+    Real change = 0.0;
+    for (unsigned int i = 0; i < _voigt.size(); ++i)
+      change = std::max(change,
+                        componentChange(_voigt[i], other._voigt[i], reference._voigt[i], floor));
+    for (unsigned int i = 0; i < _limits.size(); ++i)
+      change = std::max(change,
+                        componentChange(_limits[i], other._limits[i], reference._limits[i], floor));
+    return change;
+  }
+
+  /// Relative change of a single component, see relativeChange()
+  static Real componentChange(Real value, Real other, Real reference, Real floor)
+  {
+    const Real difference = std::abs(value - other);
+    if (difference == 0.0)
+      return 0.0;
+    return difference / std::max(std::abs(value), floor * std::abs(reference));
+  }
+
+private:
+  /// Voigt components of all tensors, stored contiguously
+  std::array<Real, 6 * NTensors> _voigt;
+
+  /// Scalar limits (yield and strength/strain limits)
+  std::array<Real, NLimits> _limits;
+
+  /// Bitfield of the boolean state flags
+  std::uint32_t _flags;
+};
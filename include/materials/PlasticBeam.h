@@ -11,6 +11,7 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "ElementUpdateCache.h"
 
 /**
  * PlasticBeam defines a displacement and rotation strain increment and rotation
@@ -36,6 +37,9 @@ public:
 protected:
   virtual void initQpStatefulProperties() override;
 
+  /// Computes the element-constant gradients of the nodal increments in the beam local frame
+  void computeLocalGradients();
+
   /// Computes the displacement and rotation strain increments
   void computeQpStrain();
 
@@ -138,6 +142,9 @@ protected:
   /// Gradient of rotation calculated in the beam local configuration at time t
   RealVectorValue _grad_rot_0_local_t;
 
+  /// Gradient of rotation in the beam local configuration before the plastic correction
+  RealVectorValue _grad_rot_0_local_elem;
+
   /// Average rotation calculated in the beam local configuration at time t
   RealVectorValue _avg_rot_local_t;
 
@@ -203,5 +210,24 @@ protected:
   /// maximum no. of iterations
   const unsigned int _max_its;
 
+  /// Return map iterations and plastic flag of the step, for the counters
+  MaterialProperty<Real> & _return_map_iterations;
+  MaterialProperty<Real> & _plastic_active;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+  const Real _max_plastic_increment_ratio;
+
+  /// Largest next time step estimated from the plastic increment, the iterations and first yield
+  MaterialProperty<Real> & _matl_timestep_limit;
+
+  /// Reuse of the outputs of elements whose nodal increments did not change, null if disabled
+  std::unique_ptr<ElementUpdateCache> _update_cache;
+
+  /// Increments of the 12 nodal degrees of freedom of the current element, the cache key
+  std::vector<Real> _dof_increments;
 
+  /// PerfGraph section timing computeStiffnessMatrix
+  const PerfID _compute_stiffness_matrix_timer;
 };
@@ -0,0 +1,378 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+#include "MooseException.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Return mapping core shared by the J2 radial return models (Bilin1,
+ * CombinedHardeningStressUpdatel, SelectiveHardeningStressUpdate and
+ * KinematicPlasticityStressUpdate). The consistency condition
+ *
+ *   q_tr - 3 G dp - R(dp) - K(dp) - sigma_y = 0
+ *
+ * is written in terms of an isotropic law R and a kinematic (back stress) law K, both given as
+ * increments over the start of step values. The laws are template parameters: when both are
+ * linear the plastic multiplier is evaluated in closed form, and Newton iterations are only
+ * compiled in for nonlinear laws.
+ */
+namespace RadialReturnCore
+{
+/// Law category tags used to select the closed form or the Newton solve
+struct LinearLawTag
+{
+};
+struct NonlinearLawTag
+{
+};
+
+/// Combined category of an isotropic and a kinematic law: linear only if both are linear
+template <typename IsotropicCategory, typename KinematicCategory>
+struct CombinedCategory
+{
+  typedef NonlinearLawTag type;
+};
+
+template <>
+struct CombinedCategory<LinearLawTag, LinearLawTag>
+{
+  typedef LinearLawTag type;
+};
+
+/// Constant slope hardening, usable as either the isotropic or the kinematic law
+struct LinearHardening
+{
+  typedef LinearLawTag category;
+
+  explicit LinearHardening(Real slope) : _slope(slope) {}
+
+  Real increment(Real dp) const { return _slope * dp; }
+  Real derivative(Real /*dp*/) const { return _slope; }
+
+  const Real _slope;
+};
+
+/**
+ * Hardening given by a curve h(p) of the accumulated equivalent plastic strain, so that the
+ * increment over the step is h(p_old + dp) - h(p_old). Curve must provide value(p) and
+ * derivative(p).
+ */
+template <typename Curve>
+struct CurveHardening
+{
+  typedef NonlinearLawTag category;
+
+  CurveHardening(const Curve & curve, Real p_old)
+    : _curve(curve), _p_old(p_old), _h_old(curve.value(p_old))
+  {
+  }
+
+  Real increment(Real dp) const { return _curve.value(_p_old + dp) - _h_old; }
+  Real derivative(Real dp) const { return _curve.derivative(_p_old + dp); }
+
+  const Curve & _curve;
+  const Real _p_old;
+  const Real _h_old;
+};
+
+/// Residual of the consistency condition scaled by 3G, i.e. in units of equivalent strain
+template <typename IsotropicLaw, typename KinematicLaw>
+Real
+residual(Real effective_trial_stress,
+         Real yield_stress,
+         Real three_shear_modulus,
+         const IsotropicLaw & isotropic,
+         const KinematicLaw & kinematic,
+         Real dp)
+{
+  return (effective_trial_stress - isotropic.increment(dp) - kinematic.increment(dp) -
+          yield_stress) /
+             three_shear_modulus -
+         dp;
+}
+
+/// Derivative of residual() with respect to dp
+template <typename IsotropicLaw, typename KinematicLaw>
+Real
+derivative(Real three_shear_modulus,
+           const IsotropicLaw & isotropic,
+           const KinematicLaw & kinematic,
+           Real dp)
+{
+  return -1.0 - (isotropic.derivative(dp) + kinematic.derivative(dp)) / three_shear_modulus;
+}
+
+/// Exact plastic multiplier for linear laws
+template <typename IsotropicLaw, typename KinematicLaw>
+bool
+plasticMultiplierImpl(Real effective_trial_stress,
+                      Real yield_stress,
+                      Real three_shear_modulus,
+                      const IsotropicLaw & isotropic,
+                      const KinematicLaw & kinematic,
+                      Real & dp,
+                      Real /*relative_tolerance*/,
+                      Real /*absolute_tolerance*/,
+                      unsigned int /*max_its*/,
+                      unsigned int & iterations,
+                      LinearLawTag)
+{
+  dp = (effective_trial_stress - yield_stress) /
+       (three_shear_modulus + isotropic.derivative(0.0) + kinematic.derivative(0.0));
+  iterations = 1;
+  return true;
+}
+
+/// Newton iterations for nonlinear laws, started from the tangent (linearized) prediction
+template <typename IsotropicLaw, typename KinematicLaw>
+bool
+plasticMultiplierImpl(Real effective_trial_stress,
+                      Real yield_stress,
+                      Real three_shear_modulus,
+                      const IsotropicLaw & isotropic,
+                      const KinematicLaw & kinematic,
+                      Real & dp,
+                      Real relative_tolerance,
+                      Real absolute_tolerance,
+                      unsigned int max_its,
+                      unsigned int & iterations,
+                      NonlinearLawTag)
+{
+  dp = (effective_trial_stress - yield_stress) /
+       (three_shear_modulus + isotropic.derivative(0.0) + kinematic.derivative(0.0));
+
+  // reference residual of the elastic predictor, for the relative convergence check
+  const Real reference = std::abs(residual(
+      effective_trial_stress, yield_stress, three_shear_modulus, isotropic, kinematic, 0.0));
+
+  for (iterations = 1; iterations <= max_its; ++iterations)
+  {
+    const Real res = residual(
+        effective_trial_stress, yield_stress, three_shear_modulus, isotropic, kinematic, dp);
+    if (std::abs(res) <= absolute_tolerance || std::abs(res) <= relative_tolerance * reference)
+      return true;
+
+    dp -= res / derivative(three_shear_modulus, isotropic, kinematic, dp);
+    if (dp < 0.0)
+      dp = 0.0;
+  }
+
+  iterations = max_its;
+  return false;
+}
+
+/**
+ * Solves the consistency condition for the equivalent plastic strain increment dp. Returns false
+ * if the Newton iterations of a nonlinear law did not converge within max_its. dp is zero when the
+ * trial state is inside the yield surface. If iterations is given, the number of evaluations of the
+ * consistency condition is added to it: none for an elastic step, one for the closed form.
+ */
+template <typename IsotropicLaw, typename KinematicLaw>
+bool
+plasticMultiplier(Real effective_trial_stress,
+                  Real yield_stress,
+                  Real three_shear_modulus,
+                  const IsotropicLaw & isotropic,
+                  const KinematicLaw & kinematic,
+                  Real & dp,
+                  Real relative_tolerance = 1e-8,
+                  Real absolute_tolerance = 1e-11,
+                  unsigned int max_its = 100,
+                  unsigned int * iterations = nullptr)
+{
+  dp = 0.0;
+  if (effective_trial_stress - yield_stress <= 0.0)
+    return true;
+
+  typedef typename CombinedCategory<typename IsotropicLaw::category,
+                                    typename KinematicLaw::category>::type Category;
+  unsigned int its = 0;
+  const bool converged = plasticMultiplierImpl(effective_trial_stress,
+                                               yield_stress,
+                                               three_shear_modulus,
+                                               isotropic,
+                                               kinematic,
+                                               dp,
+                                               relative_tolerance,
+                                               absolute_tolerance,
+                                               max_its,
+                                               its,
+                                               Category());
+  if (iterations)
+    *iterations += its;
+  return converged;
+}
+
+/// Effective (von Mises) value of a deviatoric tensor
+inline Real
+effectiveStress(const RankTwoTensor & deviator)
+{
+  return std::sqrt(1.5 * deviator.doubleContraction(deviator));
+}
+
+/// Plastic strain increment along the flow direction of the shifted trial deviator
+inline RankTwoTensor
+plasticStrainIncrement(const RankTwoTensor & shifted_deviator,
+                       Real effective_trial_stress,
+                       Real dp)
+{
+  return shifted_deviator * (1.5 * dp / effective_trial_stress);
+}
+
+/**
+ * Secant slope of the kinematic law over the step, used to update the back stress as
+ * alpha = alpha_old + 2/3 H dep so that |alpha - alpha_old| matches K(dp)
+ */
+template <typename KinematicLaw>
+Real
+kinematicSlope(const KinematicLaw & kinematic, Real dp)
+{
+  return dp > 0.0 ? kinematic.increment(dp) / dp : kinematic.derivative(0.0);
+}
+
+/// Quantities of the last return map needed by the algorithmic tangent
+struct ReturnData
+{
+  ReturnData() : effective_trial_stress(0.0), dp(0.0), hardening_modulus(0.0) {}
+
+  /// deviatoric trial stress shifted by the back stress used for the return
+  RankTwoTensor flow_deviator;
+  Real effective_trial_stress;
+  Real dp;
+  /// total hardening modulus dR/dp + dK/dp at the converged dp
+  Real hardening_modulus;
+};
+
+/**
+ * Algorithmic (consistent) tangent of the radial return for an isotropic elasticity tensor,
+ *
+ *   C = K 1x1 + 2G theta I_dev - 2G theta_bar n x n,
+ *   theta = 1 - 3G dp / q_tr,   theta_bar = 3G / (3G + H) - 3G dp / q_tr,
+ *
+ * with n the unit flow direction and H the total (isotropic + kinematic) hardening modulus. The
+ * back stress increment is parallel to n, so the same expression holds for kinematic, combined
+ * and deteriorating (negative H) hardening. Reduces to the elastic tensor for elastic steps.
+ */
+inline RankFourTensor
+consistentTangent(Real bulk_modulus, Real shear_modulus, const ReturnData & data)
+{
+  const RankTwoTensor identity(RankTwoTensor::initIdentity);
+  const RankFourTensor volumetric = identity.outerProduct(identity);
+  const RankFourTensor deviatoric =
+      RankFourTensor(RankFourTensor::initIdentitySymmetricFour) - volumetric / 3.0;
+
+  if (data.dp <= 0.0 || data.effective_trial_stress <= 0.0)
+    return bulk_modulus * volumetric + 2.0 * shear_modulus * deviatoric;
+
+  const Real three_shear_modulus = 3.0 * shear_modulus;
+  const Real ratio = three_shear_modulus * data.dp / data.effective_trial_stress;
+  const Real theta = 1.0 - ratio;
+  const Real theta_bar =
+      three_shear_modulus / (three_shear_modulus + data.hardening_modulus) - ratio;
+
+  const RankTwoTensor n =
+      data.flow_deviator / std::sqrt(data.flow_deviator.doubleContraction(data.flow_deviator));
+
+  return bulk_modulus * volumetric + 2.0 * shear_modulus * theta * deviatoric -
+         2.0 * shear_modulus * theta_bar * n.outerProduct(n);
+}
+
+/// Material point state carried from one substep to the next
+template <typename State>
+struct SubstepState
+{
+  /// packed internal variables of the model
+  State state;
+  RankTwoTensor stress;
+  RankTwoTensor elastic_strain;
+  RankTwoTensor total_strain;
+  /// inelastic strain and scalar effective inelastic strain accumulated over the increment
+  RankTwoTensor inelastic_strain;
+  Real effective_inelastic_strain;
+};
+
+/**
+ * Integrates a strain increment in adaptively sized substeps with an embedded error estimate. A
+ * fraction h of the increment is integrated once in full and once as two halves; the halves are
+ * accepted when the norm of the difference between the two end stresses is below tolerance times
+ * stress_scale, and h then grows again. Elastic full steps are exact and accepted without
+ * the check, so only material points that yield pay for the extra evaluations. Step is called as
+ * bool step(const StepState & start, Real fraction, StepState & end) and returns true if the step
+ * was plastic, or throws MooseException to reject the step, which is then halved. Returns false
+ * if the tolerance cannot be met with steps of at least 1/max_substeps.
+ */
+template <typename StepState, typename Step>
+bool
+substep(const StepState & start,
+        const Step & step,
+        Real tolerance,
+        Real stress_scale,
+        unsigned int max_substeps,
+        StepState & end,
+        unsigned int & num_substeps)
+{
+  const Real min_fraction = 1.0 / max_substeps;
+  StepState current = start;
+  StepState full, half, mid;
+  Real t = 0.0;
+  Real h = 1.0;
+  num_substeps = 0;
+
+  while (t < 1.0)
+  {
+    h = std::min(h, 1.0 - t);
+
+    // a step the model rejects by throwing is retried with half the size, like an inaccurate one
+    try
+    {
+      if (!step(current, h, full))
+      {
+        current = full;
+        t += h;
+        ++num_substeps;
+        continue;
+      }
+
+      step(current, 0.5 * h, mid);
+      step(mid, 0.5 * h, half);
+    }
+    catch (MooseException &)
+    {
+      if (0.5 * h < min_fraction)
+        throw;
+      h *= 0.5;
+      continue;
+    }
+
+    const RankTwoTensor difference = full.stress - half.stress;
+    const Real error = std::sqrt(difference.doubleContraction(difference));
+
+    if (error <= tolerance * stress_scale)
+    {
+      current = half;
+      t += h;
+      num_substeps += 2;
+      h *= 2.0;
+    }
+    else if (0.5 * h >= min_fraction)
+      h *= 0.5;
+    else
+      return false;
+  }
+
+  end = current;
+  return true;
+}
+}
@@ -0,0 +1,301 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PackedPlasticityState.h"
+#include "RadialReturnCore.h"
+#include "MooseUtils.h"
+
+/**
+ * Single material point integration of the J2 radial return models, free of material properties
+ * so the same code runs in the materials (Bilin1, CombinedHardeningStressUpdatel,
+ * SelectiveHardeningStressUpdate, KinematicPlasticityStressUpdate) and in the mesh-free material
+ * point driver of the unit app. Each point model is a small value type holding the parameters of
+ * the step, the layout of its packed state and
+ *
+ *   bool integrateStep(start, strain_increment, total_strain_increment, elasticity_tensor, end,
+ *                      return_data, iterations) const
+ *
+ * which advances a SubstepState over a mechanical strain increment and returns true if the step
+ * was plastic. The inelastic strains of start are those accumulated over the increment, usually
+ * zero. The last return is stored in return_data for the consistent tangent, the return map
+ * evaluations are added to iterations, and a step the model rejects throws a MooseException.
+ * The elasticity tensor must be isotropic.
+ */
+
+/// Bilinear kinematic hardening with deterioration of the strength past the peak strength
+struct Bilin1Point
+{
+  Bilin1Point(Real yield_stress_, Real hardening_constant_, Real det_constant_, Real peak_strength_)
+    : yield_stress(yield_stress_),
+      hardening_constant(hardening_constant_),
+      det_constant(det_constant_),
+      peak_strength(peak_strength_)
+  {
+  }
+
+  /// Slots of the packed internal state
+  enum StateTensor
+  {
+    BACK_STRESS,     // backstress tensor
+    BACK_TEST,       // backstress for when strength limit is reached
+    DET_BACK_STRESS, // backstress for deteriorating part of response
+    EFFECTIVE_STRESS
+  };
+  enum StateFlag
+  {
+    DAMAGE,
+    DAMAGEPOS, // positive side has deteriorated
+    DAMAGENEG, // negative side has deteriorated
+    ISTESTPOS, // strength limit occurs before yield surface on the positive side
+    ISTESTNEG  // strength limit occurs before yield surface on the negative side
+  };
+  enum StateLimit
+  {
+    YIELD, // yield stress used in each plastic iteration
+    MAXPOS,
+    MAXNEG,
+    STRAIN_MAX,
+    STRAIN_MIN,
+    TH_POS,
+    TH_NEG
+  };
+  typedef PackedPlasticityState<4, 7> State;
+  typedef RadialReturnCore::SubstepState<State> StepState;
+
+  /// Sets the state of a virgin material point
+  void initState(State & state) const;
+
+  /// Integrates one (sub)step; the strains of the strength limits follow the total strain
+  bool integrateStep(const StepState & start,
+                     const RankTwoTensor & strain_increment,
+                     const RankTwoTensor & total_strain_increment,
+                     const RankFourTensor & elasticity_tensor,
+                     StepState & end,
+                     RadialReturnCore::ReturnData & return_data,
+                     unsigned int & iterations) const;
+
+  /// Extrapolates the cumulative slots of state by num_cycles load cycles of increment
+  void extrapolateCycles(State & state, const State & increment, Real num_cycles) const;
+
+  const Real yield_stress;
+  const Real hardening_constant;
+  const Real det_constant;
+  const Real peak_strength;
+};
+
+/// Kinematic hardening with isotropic deterioration once the peak strength is reached
+struct CombinedHardeningPoint
+{
+  CombinedHardeningPoint(Real yield_stress_,
+                         Real hardening_constant_,
+                         Real det_constant_,
+                         Real peak_strength_)
+    : yield_stress(yield_stress_),
+      hardening_constant(hardening_constant_),
+      det_constant(det_constant_),
+      peak_strength(peak_strength_)
+  {
+  }
+
+  /// Slots of the packed internal state
+  enum StateTensor
+  {
+    BACK_STRESS
+  };
+  enum StateFlag
+  {
+    DAMAGE
+  };
+  enum StateLimit
+  {
+    HARDENING_VARIABLE,
+    MAXPOS, // strength limits
+    MAXNEG
+  };
+  typedef PackedPlasticityState<1, 3> State;
+  typedef RadialReturnCore::SubstepState<State> StepState;
+
+  void initState(State & state) const;
+
+  bool integrateStep(const StepState & start,
+                     const RankTwoTensor & strain_increment,
+                     const RankTwoTensor & total_strain_increment,
+                     const RankFourTensor & elasticity_tensor,
+                     StepState & end,
+                     RadialReturnCore::ReturnData & return_data,
+                     unsigned int & iterations) const;
+
+  void extrapolateCycles(State & state, const State & increment, Real num_cycles) const;
+
+  const Real yield_stress;
+  const Real hardening_constant;
+  const Real det_constant;
+  const Real peak_strength;
+};
+
+/**
+ * Kinematic hardening with isotropic deterioration once the peak strength gamma times the yield
+ * stress is reached, down to a residual strength beta times the yield stress
+ */
+struct SelectiveHardeningPoint
+{
+  SelectiveHardeningPoint(
+      Real yield_stress_, Real hardening_constant_, Real det_constant_, Real gamma_, Real beta_)
+    : yield_stress(yield_stress_),
+      hardening_constant(hardening_constant_),
+      det_constant(det_constant_),
+      gamma(gamma_),
+      beta(beta_)
+  {
+  }
+
+  /// Slots of the packed internal state
+  enum StateTensor
+  {
+    BACK_STRESS
+  };
+  enum StateFlag
+  {
+    DAMAGE
+  };
+  enum StateLimit
+  {
+    HARDENING_VARIABLE,
+    MAXSTRESS // strength limit
+  };
+  typedef PackedPlasticityState<1, 2> State;
+  typedef RadialReturnCore::SubstepState<State> StepState;
+
+  void initState(State & state) const;
+
+  bool integrateStep(const StepState & start,
+                     const RankTwoTensor & strain_increment,
+                     const RankTwoTensor & total_strain_increment,
+                     const RankFourTensor & elasticity_tensor,
+                     StepState & end,
+                     RadialReturnCore::ReturnData & return_data,
+                     unsigned int & iterations) const;
+
+  const Real yield_stress;
+  const Real hardening_constant;
+  const Real det_constant;
+  const Real gamma;
+  const Real beta;
+};
+
+/**
+ * Kinematic hardening with a back stress law of RadialReturnCore, a LinearHardening or a
+ * CurveHardening started from the accumulated plastic strain at the start of the step
+ */
+template <typename KinematicLaw>
+struct KinematicPlasticityPoint
+{
+  KinematicPlasticityPoint(Real yield_stress_,
+                           const KinematicLaw & kinematic_,
+                           Real relative_tolerance_ = 1e-8,
+                           Real absolute_tolerance_ = 1e-11,
+                           unsigned int max_its_ = 100)
+    : yield_stress(yield_stress_),
+      kinematic(kinematic_),
+      relative_tolerance(relative_tolerance_),
+      absolute_tolerance(absolute_tolerance_),
+      max_its(max_its_)
+  {
+  }
+
+  enum StateTensor
+  {
+    BACK_STRESS
+  };
+  typedef PackedPlasticityState<1, 0> State;
+  typedef RadialReturnCore::SubstepState<State> StepState;
+
+  void initState(State & state) const { state.zero(); }
+
+  bool integrateStep(const StepState & start,
+                     const RankTwoTensor & strain_increment,
+                     const RankTwoTensor & total_strain_increment,
+                     const RankFourTensor & elasticity_tensor,
+                     StepState & end,
+                     RadialReturnCore::ReturnData & return_data,
+                     unsigned int & iterations) const;
+
+  const Real yield_stress;
+  const KinematicLaw kinematic;
+  const Real relative_tolerance;
+  const Real absolute_tolerance;
+  const unsigned int max_its;
+};
+
+template <typename KinematicLaw>
+bool
+KinematicPlasticityPoint<KinematicLaw>::integrateStep(const StepState & start,
+                                                      const RankTwoTensor & strain_increment,
+                                                      const RankTwoTensor & total_strain_increment,
+                                                      const RankFourTensor & elasticity_tensor,
+                                                      StepState & end,
+                                                      RadialReturnCore::ReturnData & return_data,
+                                                      unsigned int & iterations) const
+{
+  end = start;
+  end.total_strain += total_strain_increment;
+
+  // deviatoric trial stress shifted by the back stress
+  const RankTwoTensor stress_trial = elasticity_tensor * (start.elastic_strain + strain_increment);
+  const RankTwoTensor back_stress_old = start.state.tensor(BACK_STRESS);
+  const RankTwoTensor effective_stress = stress_trial.deviatoric() - back_stress_old;
+  const Real effective_trial_stress = RadialReturnCore::effectiveStress(effective_stress);
+
+  // shear modulus of the isotropic elasticity tensor
+  const Real three_shear_modulus = 3.0 * elasticity_tensor(0, 1, 0, 1);
+
+  // Closed form return for a linear law, Newton iterations for a hardening curve
+  return_data = RadialReturnCore::ReturnData();
+  Real scalar_inelastic_strain = 0.0;
+  if (!MooseUtils::absoluteFuzzyEqual(effective_trial_stress, 0.0))
+  {
+    if (!RadialReturnCore::plasticMultiplier(effective_trial_stress,
+                                             yield_stress,
+                                             three_shear_modulus,
+                                             RadialReturnCore::LinearHardening(0.0),
+                                             kinematic,
+                                             scalar_inelastic_strain,
+                                             relative_tolerance,
+                                             absolute_tolerance,
+                                             max_its,
+                                             &iterations))
+      throw MooseException("KinematicPlasticityStressUpdate: Plasticity model did not converge");
+    return_data.hardening_modulus = kinematic.derivative(scalar_inelastic_strain);
+  }
+
+  return_data.flow_deviator = effective_stress;
+  return_data.effective_trial_stress = effective_trial_stress;
+  return_data.dp = scalar_inelastic_strain;
+
+  RankTwoTensor inelastic_strain_increment;
+  if (scalar_inelastic_strain != 0.0)
+  {
+    inelastic_strain_increment = RadialReturnCore::plasticStrainIncrement(
+        effective_stress, effective_trial_stress, scalar_inelastic_strain);
+
+    const Real hardening_slope =
+        RadialReturnCore::kinematicSlope(kinematic, scalar_inelastic_strain);
+    end.state.setTensor(BACK_STRESS,
+                        back_stress_old + 2.0 / 3.0 * hardening_slope * inelastic_strain_increment);
+  }
+
+  end.elastic_strain = start.elastic_strain + strain_increment - inelastic_strain_increment;
+  end.stress = elasticity_tensor * end.elastic_strain;
+  end.inelastic_strain = start.inelastic_strain + inelastic_strain_increment;
+  end.effective_inelastic_strain = start.effective_inelastic_strain + scalar_inelastic_strain;
+
+  return scalar_inelastic_strain > 0.0;
+}
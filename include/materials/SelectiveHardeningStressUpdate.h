@@ -10,6 +10,8 @@
 #pragma once
 
 #include "RadialReturnStressUpdate.h"
+#include "RadialReturnPointModels.h"
+#include "TimeStepLimit.h"
 
 /**
  * This class uses the Discrete material in a radial return Kinematic plasticity
@@ -50,17 +52,19 @@ protected:
                          bool compute_full_tangent_operator,
                          RankFourTensor & tangent_operator) override;
 
-  virtual void computeStressInitialize(const Real & effective_trial_stress,
-                                       const RankFourTensor & elasticity_tensor) override;
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeReferenceResidual(const Real & effective_trial_stress, const Real & scalar_effective_inelastic_strain) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
-  virtual void iterationFinalize(Real scalar) override;
   virtual void computeStressFinalize(const RankTwoTensor & plastic_strain_increment) override;
+  virtual Real computeTimeStepLimit() override;
 
   virtual void computeYieldStress(const RankFourTensor & elasticity_tensor);
+
   virtual Real computeEffectiveStress(RankTwoTensor stress);
 
+  /// Point integration of this model at the current yield stress, shared with the unit app driver
+  SelectiveHardeningPoint point() const;
+
   /// a string to prepend to the plastic strain Material Property name
   const std::string _plastic_prepend;
 
@@ -71,11 +75,6 @@ protected:
   const Real _gamma;
   const Real _beta;
 
-  Real _peak_strength;
-  Real _yield_condition;
-  Real _hardening_slope;
-  Real _det_slope;
-
   /// plastic strain in this model
   MaterialProperty<RankTwoTensor> & _plastic_strain;
 
@@ -84,19 +83,31 @@ protected:
 
   Real _youngs_modulus;
 
-  MaterialProperty<RankTwoTensor> & _back_stress;
-  const MaterialProperty<RankTwoTensor> & _back_stress_old;
-  MaterialProperty<Real> & _hardening_variable;
-  const MaterialProperty<Real> & _hardening_variable_old;
-  MaterialProperty<bool> & _omega;
-  const MaterialProperty<bool> & _omega_old;
+  typedef SelectiveHardeningPoint::State State;
+  typedef SelectiveHardeningPoint::StepState StepState;
 
-  /// strength limits
-  MaterialProperty<Real> & _maxstress;
-  const MaterialProperty<Real> & _maxstress_old;
+  /// backstress, hardening variable, damage flag and strength limit packed into one record
+  MaterialProperty<State> & _state;
+  const MaterialProperty<State> & _state_old;
 
   const VariableValue & _temperature;
 
-  Real old;
-  Real s_new;
+  /// Flow direction, trial stress, increment and hardening modulus of the last return map
+  RadialReturnCore::ReturnData _return_data;
+
+  /// Return map evaluations (over all substeps) and plastic flag of the step, for the counters
+  MaterialProperty<Real> & _return_map_iterations;
+  MaterialProperty<Real> & _plastic_active;
+  unsigned int _iterations;
+
+  /// Time step limit controls
+  const Real _target_return_iterations;
+  const Real _transition_tolerance;
+
+  /// Effective stresses of the step against the yield stress and the peak strength
+  TimeStepLimit::Transition _yield_transition;
+  TimeStepLimit::Transition _peak_transition;
+
+  /// PerfGraph section timing updateState
+  const PerfID _update_state_timer;
 };
@@ -0,0 +1,100 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InputParameters.h"
+
+#include <cmath>
+#include <limits>
+
+/**
+ * Time step indicators shared by the otter material models. From the rates of the step just
+ * computed, every model estimates the largest next step that keeps its plastic increment and its
+ * return map iterations bounded and that stops on its next state transition (first yield, peak
+ * strength) instead of stepping over it. A model with nothing to limit returns none(), so the
+ * limits of several models combine by their minimum. They are reported in the matl_timestep_limit
+ * property read by MaterialTimeStepPostprocessor, which PlasticityAdaptiveDT consumes.
+ */
+namespace TimeStepLimit
+{
+/// Limit of a model that does not restrict the step
+inline Real
+none()
+{
+  return std::numeric_limits<Real>::max();
+}
+
+/// Start and end of step values of an indicator that changes the model state on reaching target
+struct Transition
+{
+  Real old_value = 0.0;
+  Real value = 0.0;
+  Real target = std::numeric_limits<Real>::max();
+};
+
+/**
+ * Step that lands an indicator on its target if it keeps the rate of the last step dt. Indicators
+ * moving away from the target, or within tolerance (relative to the target) of it, are not limited.
+ */
+inline Real
+approach(Real dt, const Transition & transition, Real tolerance)
+{
+  const Real distance_old = transition.target - transition.old_value;
+  const Real distance = transition.target - transition.value;
+  if (distance <= tolerance * std::abs(transition.target) || distance >= distance_old)
+    return none();
+  return dt * distance / (distance_old - distance);
+}
+
+/// Step over which an increment growing at the rate of the last step dt reaches max_increment
+inline Real
+increment(Real dt, Real increment, Real max_increment)
+{
+  if (increment == 0.0)
+    return none();
+  return dt * max_increment / std::abs(increment);
+}
+
+/// Step that brings the return map iterations of the last step dt down to the target
+inline Real
+iterations(Real dt, Real iterations, Real target)
+{
+  if (iterations <= target)
+    return none();
+  return dt * target / iterations;
+}
+
+/**
+ * Parameters of the iteration and transition indicators. The models without a radial return
+ * base class also take the plastic increment bound, relative to the elastic deformation at yield.
+ */
+inline void
+addParams(InputParameters & params, bool plastic_increment)
+{
+  params.addRangeCheckedParam<Real>(
+      "target_return_iterations",
+      10.0,
+      "target_return_iterations > 0",
+      "Return map iterations per step above which the time step limit shrinks the step");
+  params.addRangeCheckedParam<Real>(
+      "transition_tolerance",
+      0.01,
+      "transition_tolerance >= 0",
+      "Relative distance to a state transition (yield, peak strength) below which the time step "
+      "limit no longer shrinks the step to land on it");
+  if (plastic_increment)
+    params.addRangeCheckedParam<Real>(
+        "max_plastic_increment_ratio",
+        0.5,
+        "max_plastic_increment_ratio > 0",
+        "Largest plastic deformation increment per step, relative to the elastic deformation at "
+        "yield, used in the time step limit");
+}
+}
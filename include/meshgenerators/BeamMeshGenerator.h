@@ -0,0 +1,47 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Builds a straight or polyline beam/pile mesh of EDGE2 or EDGE3 elements in memory. Every
+ * segment between two consecutive points has its own number of elements, grading and section:
+ *
+ *  - bias is the length ratio of consecutive elements; with bias > 1 the elements grow away from
+ *    the start of the segment, or away from both ends with refine_both_ends, so that the mesh is
+ *    refined toward supports and hinge regions placed at the segment ends.
+ *  - section is the subdomain id of the segment and section_names its (optional) block name, so
+ *    that the beam materials and BeamSectionAux pick up the section of every element by block.
+ *
+ * The first and last points are the boundaries start and end (node and side sets); the interior
+ * points are the node sets vertex_1, vertex_2, ... for supports and hinges.
+ */
+class BeamMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  BeamMeshGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Element end positions along a segment as fractions of its length
+  static std::vector<Real> grading(unsigned int n, Real bias, bool both_ends);
+
+  const std::vector<Point> & _points;
+  std::vector<unsigned int> _nx;
+  std::vector<Real> _bias;
+  std::vector<bool> _both_ends;
+  std::vector<subdomain_id_type> _sections;
+  const std::vector<SubdomainName> _section_names;
+  const bool _second_order;
+};
@@ -0,0 +1,89 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AdvancedOutput.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Postprocessor and vector postprocessor histories in a columnar binary format. Every column is
+ * a little endian float64 .npy file in the directory <file_base>_history that grows by
+ * appending and rewriting its fixed size header, so numpy can load or memory map it at any time
+ * (numpy.load(file, mmap_mode='r')):
+ *  - time.npy and <postprocessor>.npy, one row per output step
+ *  - <vpp>.<vector>.npy with the vectors of all steps concatenated, <vpp>.offsets.npy with the
+ *    start of every step in them and <vpp>.time.npy
+ *
+ * Rows are buffered in memory and handed to a background thread every flush_interval steps, so
+ * neither the text formatting nor the file system stalls the time steps. A downsampled CSV of
+ * the postprocessors (every csv_interval-th step) can be kept for inspection. The rows still
+ * buffered at the end of the run are written by the final output, so execute_on must contain
+ * FINAL; a run that aborts before it loses them.
+ */
+class ColumnarHistory : public AdvancedOutput
+{
+public:
+  static InputParameters validParams();
+
+  ColumnarHistory(const InputParameters & parameters);
+  virtual ~ColumnarHistory();
+
+  virtual void initialSetup() override;
+
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+  virtual void outputPostprocessors() override;
+  virtual void outputVectorPostprocessors() override;
+
+  /// Hands the buffered rows to the writer thread
+  void flush();
+
+  /// Waits for the pending background write, if any
+  void waitForWriter();
+
+  /// Number of buffered steps written at once
+  const unsigned int _flush_interval;
+
+  /// Every csv_interval-th postprocessor row is also written to the CSV file (0 for none)
+  const unsigned int _csv_interval;
+
+  /// Buffered values of each column file
+  std::map<std::string, std::vector<Real>> _buffers;
+
+  /// Total number of values of each vector postprocessor vector, for the offsets column
+  std::map<std::string, Real> _vpp_sizes;
+
+  /// Postprocessor rows and buffered rows of the downsampled CSV
+  unsigned int _pp_rows;
+  std::vector<std::string> _csv_columns;
+  std::vector<std::vector<Real>> _csv_rows;
+
+  unsigned int _buffered_steps;
+
+  /// Time of the last recorded step, so that the final output does not repeat it
+  Real _last_step_time;
+
+  /// Data owned by the writer thread while it runs
+  std::map<std::string, std::vector<Real>> _pending;
+  std::vector<std::vector<Real>> _pending_csv_rows;
+  std::map<std::string, std::size_t> _rows_written;
+  bool _csv_header_written;
+
+  std::thread _writer;
+
+  /// Set by the writer thread when a file could not be written, read after joining it
+  bool _write_failed;
+};
@@ -0,0 +1,92 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FileOutput.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class MaterialPropertyStorage;
+
+/**
+ * Incremental checkpoint of the stateful material data (current, old and older values of the
+ * interior and boundary material property storage) of the local elements.
+ *
+ * Each element is serialized into one record and hashed; only records whose hash changed since
+ * the previous checkpoint are written, so elements that stayed elastic or unloaded cost nothing
+ * after the first dump. Every full_interval checkpoints a complete frame is written and the file
+ * restarted, which bounds its length. Records are serialized on the calling thread, while
+ * compression and file IO run on a background thread that overlaps with the next time steps.
+ *
+ * Every rank appends to its own file, <file_base>.matstate.<rank>, so the reload reads all ranks
+ * in parallel. The reload (reload_from) replays the frames of the file of this rank up to
+ * reload_step, by default the time step of the regular restart, on top of the restored stateful
+ * properties, and requires the same mesh partitioning as the run that wrote it.
+ *
+ * The checkpoint is extra data next to the regular MOOSE checkpoint, not a replacement of its
+ * material part: the regular restart still restores the solution vectors and the stateful
+ * material data, and the reload then overwrites the latter with the frames of the reload step.
+ * The final output waits for the last frame, so execute_on must contain FINAL.
+ */
+class MaterialStateCheckpoint : public FileOutput
+{
+public:
+  static InputParameters validParams();
+
+  MaterialStateCheckpoint(const InputParameters & parameters);
+  virtual ~MaterialStateCheckpoint();
+
+  virtual void initialSetup() override;
+
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// Serializes all stateful values of elem in the given storage into record
+  void storeElement(MaterialPropertyStorage & storage, const Elem * elem, std::ostream & record);
+
+  /// Counterpart of storeElement
+  void loadElement(MaterialPropertyStorage & storage, const Elem * elem, std::istream & record);
+
+  /// Serializes the changed elements into a frame and hands it to the writer thread
+  void writeFrame();
+
+  /// Waits for the pending background write, if any
+  void waitForWriter();
+
+  /// Loads the records of the frames of the file written for this rank, in order, up to t_step
+  void reload(const std::string & file_name, int t_step);
+
+  /// Number of checkpoints between two complete frames
+  const unsigned int _full_interval;
+
+  /// zlib compression level (0 stores the frames uncompressed)
+  const int _compression_level;
+
+  /// Hash of the last record written for each local element
+  std::unordered_map<dof_id_type, std::uint64_t> _record_hash;
+
+  /// Number of frames written to the current file
+  unsigned int _frames_in_file;
+
+  /// Uncompressed frame handed to the writer thread; only touched after joining it
+  std::string _pending_frame;
+
+  /// Background thread compressing and writing the last frame
+  std::thread _writer;
+
+  /// Set by the writer thread when the frame could not be written, read after joining it
+  bool _write_failed;
+};
@@ -0,0 +1,116 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/utility.h"
+#include "libmesh/vector_value.h"
+
+#include <cmath>
+
+/**
+ * Elastic stress recovery from the beam resultants for the section shapes used in otter. The
+ * component is 11 (axial), 12 or 13 (shear); the axial stress combines the axial force with both
+ * bending moments and the shear stresses follow from the first moment of area (Jourawski).
+ * Shared by the single point postprocessors and BeamSectionStressSampler.
+ */
+namespace BeamSectionStress
+{
+/// Section forces and moments in the local beam frame
+struct Resultants
+{
+  RealVectorValue force;
+  RealVectorValue moment;
+};
+
+/// Solid circular section; r_location is relative to the radius, theta in degrees
+inline Real
+circular(int component, const Resultants & res, Real radius, Real r_location, Real theta)
+{
+  const Real pi = libMesh::pi;
+  const Real area = pi * radius * radius;
+  const Real y = r_location * radius * std::sin(theta * pi / 180);
+  const Real z = r_location * radius * std::cos(theta * pi / 180);
+  const Real r4 = Utility::pow<4>(radius);
+
+  switch (component)
+  {
+    case 11:
+      return res.force(0) / area + 4 * res.moment(2) * y / (pi * r4) +
+             4 * res.moment(1) * z / (pi * r4);
+    case 12:
+      return 4 * res.force(1) * (radius * radius - y * y) / (3 * pi * r4);
+    case 13:
+      return 4 * res.force(2) * (radius * radius - z * z) / (3 * pi * r4);
+  }
+  return 0.0;
+}
+
+/// Rectangular section; y_location and z_location are relative to depth and width (0 to 1)
+inline Real
+rectangular(int component, const Resultants & res, Real depth, Real width, Real y, Real z)
+{
+  switch (component)
+  {
+    case 11:
+      return res.force(0) / (depth * width) +
+             12 * res.moment(2) * (y - 0.5) * depth / (width * Utility::pow<3>(depth)) +
+             12 * res.moment(1) * (z - 0.5) * width / (depth * Utility::pow<3>(width));
+    case 12:
+      return 6 * res.force(1) * depth * depth * (0.25 - (y - 0.5) * (y - 0.5)) /
+             (width * Utility::pow<3>(depth));
+    case 13:
+      return 6 * res.force(2) * width * width * (0.25 - (z - 0.5) * (z - 0.5)) /
+             (depth * Utility::pow<3>(width));
+  }
+  return 0.0;
+}
+
+/// First moment of area over the width of the cut at distance c of a pipe section
+inline Real
+pipeShearFactor(Real ro, Real ri, Real c)
+{
+  Real q, b;
+  if (c < ri)
+  {
+    q = 2 * (std::pow(ro * ro - c * c, 1.5) - std::pow(ri * ri - c * c, 1.5)) / 3;
+    b = 2 * (std::sqrt(ro * ro - c * c) - std::sqrt(ri * ri - c * c));
+  }
+  else
+  {
+    q = 2 * (std::pow(ro * ro - c * c, 1.5)) / 3;
+    b = 2 * (std::sqrt(ro * ro - c * c));
+  }
+  return q / b;
+}
+
+/// Pipe section; r_location is relative to the thickness (0 inner, 1 outer edge), theta in degrees
+inline Real
+pipe(int component, const Resultants & res, Real ro, Real thickness, Real r_location, Real theta)
+{
+  const Real pi = libMesh::pi;
+  const Real ri = ro - thickness;
+  const Real area = pi * (ro * ro - ri * ri);
+  const Real y = (r_location * thickness + ri) * std::sin(theta * pi / 180);
+  const Real z = (r_location * thickness + ri) * std::cos(theta * pi / 180);
+  const Real polar = pi * (Utility::pow<4>(ro) - Utility::pow<4>(ri));
+
+  switch (component)
+  {
+    case 11:
+      return res.force(0) / area + 4 * res.moment(2) * y / polar + 4 * res.moment(1) * z / polar;
+    case 12:
+      return 4 * res.force(1) * pipeShearFactor(ro, ri, y) / polar;
+    case 13:
+      return 4 * res.force(2) * pipeShearFactor(ro, ri, z) / polar;
+  }
+  return 0.0;
+}
+}
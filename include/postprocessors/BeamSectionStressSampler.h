@@ -0,0 +1,90 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "BeamSectionStress.h"
+#include "MooseEnum.h"
+#include "MultiMooseEnum.h"
+
+#include <array>
+
+/**
+ * Samples the beam section stresses at many beam points and many section locations at once.
+ *
+ * The element containing every point is located once (and again only if the mesh changes). The
+ * dof indices and shape function values of the six resultant variables are cached with it, so
+ * that evaluating the resultants is a dot product with the local solution, without point
+ * location or communication. Every rank fills the points of the elements it owns and the
+ * results of all ranks are combined in one sum per execution.
+ *
+ * Each output vector holds one stress component at one section location, with one row per beam
+ * point (stress_<component>_<location index>), next to the point coordinates x, y and z.
+ */
+class BeamSectionStressSampler : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  BeamSectionStressSampler(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Locates the points and caches the interpolation data of the resultants
+  void locatePoints();
+
+  /// Stress component at section location j from the resultants
+  Real sectionStress(int component, const BeamSectionStress::Resultants & res, unsigned int j) const;
+
+  /// Three forces and three moments
+  static const unsigned int num_resultants = 6;
+
+  /// Interpolation of the six resultants at a point of a local element
+  struct SamplePoint
+  {
+    /// Row of the point in the output vectors
+    unsigned int index;
+    std::array<std::vector<dof_id_type>, num_resultants> dofs;
+    std::array<std::vector<Real>, num_resultants> phi;
+  };
+
+  const std::vector<Point> & _points;
+
+  /// Section shape and dimensions
+  const MooseEnum _section;
+  Real _dim_1;
+  Real _dim_2;
+
+  /// Section locations: (r_location, theta) for circular and pipe, (y_location, z_location) for
+  /// rectangular sections
+  const std::vector<Real> & _location_1;
+  const std::vector<Real> & _location_2;
+
+  std::vector<int> _components;
+
+  /// Resultant variables, forces then moments in the order x, y, z
+  std::array<const MooseVariableFEBase *, num_resultants> _resultant_vars;
+
+  /// Cached interpolation data of the points located in local elements
+  std::vector<SamplePoint> _local_points;
+
+  VectorPostprocessorValue & _x;
+  VectorPostprocessorValue & _y;
+  VectorPostprocessorValue & _z;
+
+  /// One vector per component and section location
+  std::vector<VectorPostprocessorValue *> _stress;
+};
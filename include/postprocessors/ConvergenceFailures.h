@@ -0,0 +1,47 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+#include <atomic>
+
+/**
+ * Counts the local convergence failures of the material models, i.e. the return maps and
+ * substepping that end in a MooseException and cut the time step. The materials call record()
+ * right before throwing; the counter is shared by all threads of the process and summed over the
+ * ranks here. The value is either the number of failures since the previous execution (which
+ * includes the failed attempts of a cut step) or the running total.
+ */
+class ConvergenceFailures : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ConvergenceFailures(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual Real getValue() override { return _value; }
+
+  /// Counts one local convergence failure, callable from any thread
+  static void record() { _failures.fetch_add(1, std::memory_order_relaxed); }
+
+protected:
+  const bool _cumulative;
+
+  /// Process counter at construction and at the previous execution
+  const unsigned long long _start;
+  unsigned long long _previous;
+
+  Real _value;
+
+  static std::atomic<unsigned long long> _failures;
+};
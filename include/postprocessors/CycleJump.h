@@ -0,0 +1,81 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+#include "libmesh/numeric_vector.h"
+
+/**
+ * Controls cycle jumping for periodic (constant amplitude) loading. Materials with a cycle_jump
+ * parameter record their internal state at the end of every load cycle and report the relative
+ * change between the state increments of the last two cycles; the maximum over all qps is passed
+ * in as rate_change. After monitor_cycles resolved cycles with a rate change below tolerance,
+ * the next step extrapolates the internal state over up to max_jump cycles, after which the
+ * cycles are resolved again to verify the extrapolation before the next jump.
+ *
+ * The nonlinear solution at the end of every cycle is kept, together with its change over the
+ * last cycle, which CycleJumpPredictor extrapolates over the jumped cycles as the initial guess of
+ * the jump step. The materials take the jumped plastic strain out of their elastic strain (see
+ * CycleJumpRecord), so the ratcheting of the jumped cycles ends up in the displacements.
+ *
+ * Since the loading is periodic, the time is not shifted by a jump; the value of this
+ * postprocessor is the number of equivalent load cycles (resolved plus jumped), which can be used
+ * to terminate the run.
+ */
+class CycleJump : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  CycleJump(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual Real getValue() override;
+
+  /// Whether the step of size dt ending at t ends a load cycle
+  bool cycleEnds(Real t, Real dt) const;
+
+  /// Number of cycles to extrapolate over at the start of the current step
+  unsigned int jumpCycles() const { return _jump; }
+
+  /// Relative floor used by the materials when comparing cycle increments
+  Real rateFloor() const { return _rate_floor; }
+
+  /// Change of the nonlinear solution over the last resolved cycle
+  const NumericVector<Number> & cycleSolutionIncrement() const { return _cycle_solution_increment; }
+
+protected:
+  const Real _period;
+  const Real _start_time;
+
+  /// Maximum relative change of the per cycle state increments over all qps
+  const PostprocessorValue & _rate_change;
+
+  const unsigned int _monitor_cycles;
+  const Real _tolerance;
+  const unsigned int _max_jump;
+  const unsigned int _num_cycles;
+  const Real _rate_floor;
+
+  /// Resolved cycles since the last jump
+  unsigned int & _resolved_since_jump;
+
+  /// Resolved plus jumped cycles
+  unsigned int & _equivalent_cycles;
+
+  /// Cycles jumped at the start of the next step
+  unsigned int & _jump;
+
+  /// Nonlinear solution at the end of the last cycle and its change over that cycle
+  NumericVector<Number> & _cycle_solution;
+  NumericVector<Number> & _cycle_solution_increment;
+};
@@ -0,0 +1,58 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/**
+ * Online misfit between the simulated response and an experimental curve, e.g. the force
+ * displacement hysteresis of a cyclic test. Cyclic curves are not functions of the displacement,
+ * so both curves are parameterized by the accumulated displacement travel sum |dx|, and the
+ * simulated y of every step is compared with the experimental y at the same travel. The value is
+ *
+ *   sqrt(sum (y - y_exp)^2 |dx| / sum |dx|) / max |y_exp|,
+ *
+ * i.e. the travel weighted RMS error relative to the peak of the experiment, over the part of
+ * the curve simulated so far. Once it exceeds abort_misfit the solve is terminated and the value
+ * is kept at no less than abort_misfit, so a calibration driver can drop diverging candidates
+ * early without ranking them above complete runs.
+ */
+class ExperimentCurveMisfit : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ExperimentCurveMisfit(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual Real getValue() override;
+
+protected:
+  /// Experimental y at the accumulated travel
+  Real experiment(Real travel) const;
+
+  const PostprocessorValue & _x;
+  const PostprocessorValue & _y;
+  const Real _x_scale;
+  const Real _y_scale;
+  const Real _abort_misfit;
+
+  /// Accumulated travel and y of the experimental points
+  std::vector<Real> _travel;
+  std::vector<Real> _y_exp;
+  Real _y_reference;
+
+  /// Previous x, accumulated travel and travel weighted squared error
+  Real & _x_old;
+  Real & _travel_sim;
+  Real & _squared_error;
+  bool & _aborted;
+};
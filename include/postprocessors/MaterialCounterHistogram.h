@@ -0,0 +1,39 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementVectorPostprocessor.h"
+
+/**
+ * Histogram over all qps of an integer valued counter material property, typically
+ * return_map_iterations. Bin i counts the qps with value i; the last bin also collects all larger
+ * values. The vectors value and count hold the bin values and the qp counts summed over all
+ * ranks.
+ */
+class MaterialCounterHistogram : public ElementVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  MaterialCounterHistogram(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  const MaterialProperty<Real> & _counter;
+
+  std::vector<unsigned long> _counts;
+
+  VectorPostprocessorValue & _value;
+  VectorPostprocessorValue & _count;
+};
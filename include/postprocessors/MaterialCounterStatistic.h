@@ -0,0 +1,52 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Statistic over all qps of a counter material property such as return_map_iterations,
+ * plastic_active or layers_in_yield, reduced over threads and ranks. The counters hold the values
+ * of the last material evaluation, so at timestep_end they describe the converged step.
+ *
+ *   mean          mean over all qps
+ *   max           largest value
+ *   sum           sum over all qps (e.g. the number of plastically active qps)
+ *   nonzero_mean  mean over the qps with a nonzero value (e.g. iterations per plastic qp)
+ */
+class MaterialCounterStatistic : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  MaterialCounterStatistic(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+
+protected:
+  const MaterialProperty<Real> & _counter;
+
+  enum class Statistic
+  {
+    MEAN,
+    MAX,
+    SUM,
+    NONZERO_MEAN
+  } _statistic;
+
+  Real _sum;
+  Real _max;
+  unsigned long _num_qps;
+  unsigned long _num_nonzero;
+};
@@ -0,0 +1,76 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+
+#include <map>
+#include <tuple>
+
+class MaterialPropertyStorage;
+
+/**
+ * Memory held by the stateful material properties, per property, block and rank. Each stateful
+ * property is stored with its old (and, if any object requests older values, older) copy, so the
+ * bytes per qp count all copies. The size of a qp value is measured from its serialized form,
+ * i.e. it is the data size without the container overhead; for vector valued properties, whose
+ * size varies between qps, bytes_per_qp is the mean.
+ *
+ * Every row of the output vectors is one property on one block (interior or boundary storage):
+ * property_id, block, boundary, bytes_per_qp, qps, bytes and share of the total. rank_bytes
+ * holds the total of every rank. The console table lists the same rows with the property names
+ * and the materials declaring them. Executes on initial by default; add other execute_on flags
+ * for on-demand reports, e.g. after adaptivity.
+ */
+class StatefulMaterialMemory : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  StatefulMaterialMemory(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// Property id, block id and whether the row is for the boundary storage
+  typedef std::tuple<unsigned int, SubdomainID, bool> RowKey;
+
+  /// Bytes (over all copies) and number of qps
+  struct RowData
+  {
+    Real bytes;
+    Real qps;
+
+    Real bytesPerQp() const { return qps > 0.0 ? bytes / qps : 0.0; }
+  };
+
+  /// Adds the properties of the local elements in storage to the rows
+  void accumulate(MaterialPropertyStorage & storage, bool boundary);
+
+  /// Names of the materials declaring every property
+  std::map<std::string, std::string> suppliers() const;
+
+  void printTable(Real total) const;
+
+  const bool _print_table;
+
+  std::map<RowKey, RowData> _rows;
+
+  VectorPostprocessorValue & _property_id;
+  VectorPostprocessorValue & _block;
+  VectorPostprocessorValue & _boundary;
+  VectorPostprocessorValue & _bytes_per_qp;
+  VectorPostprocessorValue & _qps;
+  VectorPostprocessorValue & _bytes;
+  VectorPostprocessorValue & _share;
+  VectorPostprocessorValue & _rank_bytes;
+};
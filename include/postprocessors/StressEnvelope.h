@@ -0,0 +1,58 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementVectorPostprocessor.h"
+#include "StressEnvelopeQuantity.h"
+
+/**
+ * Maximum and minimum of a stress measure (see StressEnvelopeQuantity) over every qp and section
+ * point of the block, with the location where each occurs, in one threaded element loop. The
+ * extremes of all ranks are combined by a single allgather of one fixed size record per rank.
+ *
+ * The vectors max, max_x, max_y, max_z, max_elem and max_section_point (and the same for min)
+ * each hold a single value.
+ */
+class StressEnvelope : public ElementVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  StressEnvelope(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Extreme value and where it occurs
+  struct Extreme
+  {
+    Real value;
+    Point point;
+    dof_id_type elem;
+    unsigned int section_point;
+  };
+
+  /// Replaces current by candidate if it is larger (sign 1) or smaller (sign -1)
+  static void update(Extreme & current, const Extreme & candidate, Real sign);
+
+  /// Writes an extreme into the output vectors with the given prefix
+  void store(const Extreme & extreme, std::vector<VectorPostprocessorValue *> & vectors);
+
+  StressEnvelopeQuantity _quantity;
+
+  Extreme _max;
+  Extreme _min;
+
+  std::vector<VectorPostprocessorValue *> _max_vectors;
+  std::vector<VectorPostprocessorValue *> _min_vectors;
+};
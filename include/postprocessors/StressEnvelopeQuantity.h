@@ -0,0 +1,71 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "BeamSectionStress.h"
+#include "MaterialProperty.h"
+#include "MooseEnum.h"
+#include "RankTwoTensor.h"
+
+class MaterialPropertyInterface;
+
+/**
+ * Stress measure evaluated at every qp and section point for stress envelopes:
+ *  - section: a beam stress component from the forces and moments material properties, at every
+ *    section location of a circular, rectangular or pipe section
+ *  - fiber: the layer stresses of LayeredBeam, from its layer_state or, while the section is
+ *    elastic and the layers are not stored, from the linear distribution of its stress_resultant
+ *  - von_mises: the von Mises stress of a continuum stress tensor
+ * Shared by the StressEnvelope vector postprocessor and the StressEnvelopeAux kernel.
+ */
+class StressEnvelopeQuantity
+{
+public:
+  static InputParameters validParams();
+
+  StressEnvelopeQuantity(const InputParameters & parameters, MaterialPropertyInterface & mpi);
+
+  /**
+   * Largest and smallest value over the section points (or layers) at qp, with the index of the
+   * section point where they occur
+   */
+  void evaluate(unsigned int qp,
+                Real & max,
+                unsigned int & max_index,
+                Real & min,
+                unsigned int & min_index) const;
+
+protected:
+  /// Value at section point (or layer) i of qp
+  Real value(unsigned int qp, unsigned int i) const;
+
+  const MooseEnum _quantity;
+
+  /// Section shape, dimensions and locations for the section quantity
+  const MooseEnum _section;
+  Real _dim_1;
+  Real _dim_2;
+  std::vector<Real> _location_1;
+  std::vector<Real> _location_2;
+  const int _component;
+
+  /// Number of section points (or layers) evaluated at each qp
+  unsigned int _num_points;
+
+  const MaterialProperty<RealVectorValue> * _forces;
+  const MaterialProperty<RealVectorValue> * _moments;
+
+  /// Layer state and moment of LayeredBeam, and z_i / I of the layers for elastic sections
+  const MaterialProperty<std::vector<Real>> * _layer_state;
+  const MaterialProperty<Real> * _stress_resultant;
+  std::vector<Real> _elastic_layer_factor;
+
+  const MaterialProperty<RankTwoTensor> * _stress;
+};
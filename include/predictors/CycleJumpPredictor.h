@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Predictor.h"
+
+class CycleJump;
+
+/**
+ * Initial guess of the step after a cycle jump: the solution at the end of the last resolved cycle
+ * plus scale times the number of jumped cycles times its change over that cycle. The materials
+ * take the jumped plastic strain out of their elastic strain, so without this guess the solve
+ * starts far from equilibrium; with it the jump step converges like any other step. Other steps
+ * are left to the regular initial guess.
+ */
+class CycleJumpPredictor : public Predictor
+{
+public:
+  static InputParameters validParams();
+
+  CycleJumpPredictor(const InputParameters & parameters);
+
+  virtual bool shouldApply() override;
+  virtual void apply(NumericVector<Number> & sol) override;
+
+protected:
+  /// Controller of the jump, looked up on use since predictors are set up before user objects
+  const CycleJump & cycleJump() const;
+
+  const UserObjectName & _cycle_jump_name;
+};
@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "TimeStepper.h"
+
+/**
+ * Time stepper driven by the step limits the material models report in matl_timestep_limit
+ * (collected by MaterialTimeStepPostprocessor, executed at the end of the time step). The step
+ * grows by growth_factor while the models do not restrict it, e.g. through elastic unloading, and
+ * drops to the smallest limit before a large plastic increment, a hard return map or a state
+ * transition, instead of waiting for a failed solve to cut it back.
+ */
+class PlasticityAdaptiveDT : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+
+  PlasticityAdaptiveDT(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  const Real _initial_dt;
+  const Real _growth_factor;
+
+  /// Step limits of the models, reported by the limiting postprocessors
+  std::vector<const PostprocessorValue *> _limits;
+};
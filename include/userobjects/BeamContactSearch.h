@@ -0,0 +1,105 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "CapsuleBVH.h"
+
+#include <array>
+#include <map>
+#include <set>
+
+/// One penetrating pair: elem and other_elem are pushed apart along normal
+struct BeamContact
+{
+  dof_id_type elem;
+  dof_id_type other_elem;
+  /// Contact points on both sides (a beam axis point, or a point on a surface)
+  Point point;
+  Point other_point;
+  /// Unit normal pointing from other_elem toward elem
+  Point normal;
+  /// Signed gap, negative when penetrating
+  Real gap;
+};
+
+/**
+ * Contact search for beam (line) elements against other beams and against solid surfaces. Every
+ * beam element is a capsule along its axis, swept by the section radius of its block (an EDGE3
+ * is split into two capsules at its mid node); the sides on the surfaces are triangles (a QUAD
+ * side is split in two; higher order faces use their vertices, and the sides of 2D solids are
+ * zero radius segments).
+ *
+ * The primitives are gathered on all ranks and held in a CapsuleBVH, which is refitted to the
+ * displaced mesh on every execution and only rebuilt when its boxes degrade. Every rank runs the
+ * segment-segment and segment-face narrow phase for the overlapping pairs of its own primitives,
+ * and the penetrating pairs are gathered again, so that BeamContactPenalty can load the elements
+ * on either side. Primitives sharing a node (neighboring beam elements, a beam embedded in the
+ * solid) are never in contact.
+ *
+ * Runs on the displaced mesh before every residual and Jacobian evaluation by default.
+ */
+class BeamContactSearch : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  BeamContactSearch(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /// Penetrating pairs of the last execution, on all ranks
+  const std::vector<BeamContact> & contacts() const { return _contacts; }
+
+protected:
+  /// Caches the local beam elements and surface sides
+  void findLocalEntities();
+
+  /// Packs the local primitives and gathers those of all ranks into _primitives
+  void gatherPrimitives();
+
+  /// Narrow phase for one overlapping pair; returns whether the pair penetrates
+  bool narrowPhase(unsigned int i, unsigned int j, BeamContact & contact) const;
+
+  /// Whether two primitives share a node
+  bool shareNode(unsigned int i, unsigned int j) const;
+
+  MooseMesh & _mesh;
+
+  std::vector<SubdomainID> _beam_blocks;
+  std::map<SubdomainID, Real> _radius;
+  std::set<BoundaryID> _surfaces;
+  const bool _self_contact;
+  const Real _margin;
+
+  /// Local beam elements and local surface sides (element, side)
+  std::vector<const Elem *> _local_beams;
+  std::vector<std::pair<const Elem *, unsigned int>> _local_sides;
+
+  /// Primitives of all ranks, their element, node ids and whether they are beams
+  std::vector<CapsuleBVH::Primitive> _primitives;
+  std::vector<dof_id_type> _primitive_elem;
+  std::vector<std::array<dof_id_type, 3>> _primitive_nodes;
+  std::vector<bool> _is_beam;
+  /// First primitive of this rank and number of local primitives
+  std::size_t _local_begin;
+  std::size_t _local_count;
+
+  CapsuleBVH _bvh;
+  std::vector<CapsuleBVH::PrimitivePair> _pairs;
+  std::vector<BeamContact> _contacts;
+
+  const PerfID _search_timer;
+};
@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+"""Calibrates material parameters against an experimental curve with a parallel Nelder-Mead search.
+
+    ./calibrate.py --executable ../otter-opt --input mcrae_new_pars_c0.i \
+        --experiment experiment.csv --material plasticity \
+        --param yield_stress 250 400 315 --param hardening_constant 500 2000 1200 \
+        --param deterioration_constant -500 0 -200 \
+        --x-pp disp_y --y-pp force_y --y-scale -0.001 --mpi-procs 8
+
+Every batch of candidates runs in a single launch: a master input with a FullSolveMultiApp holds
+one sub-app per candidate (max_procs_per_app ranks each, so the candidates solve concurrently on
+their own sub-communicators) and collects the ExperimentCurveMisfit of every sub-app into one
+scalar variable. The search evaluates the reflection, expansion and both contractions of every
+iteration as one batch, and the shrink steps as another, so all ranks stay busy. Candidates whose
+misfit exceeds abort_factor times the worst simplex vertex terminate early. If a batch launch
+fails (e.g. a sub-app diverges), its candidates are rerun one by one and failures score inf.
+
+The parameters are set on the material block --material of --input (e.g. yield_stress,
+hardening_constant, deterioration_constant and peak_strength of CombinedHardeningStressUpdatel or
+Bilin1). Every evaluation is appended to calibration_history.csv in the work directory.
+"""
+import argparse
+import csv
+import math
+import os
+import subprocess
+import sys
+
+# the SCALAR variable collecting the misfits has one component per sub-app, up to libMesh's
+# highest order
+MAX_BATCH = 43
+
+MASTER = """[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[AuxVariables]
+  [misfit]
+    family = SCALAR
+    order = {order}
+  []
+[]
+
+[MultiApps]
+  [candidates]
+    type = FullSolveMultiApp
+    input_files = {input}
+    positions = '{positions}'
+    cli_args = '{cli_args}'
+    max_procs_per_app = {procs_per_app}
+    execute_on = initial
+  []
+[]
+
+[Transfers]
+  [misfit]
+    type = MultiAppPostprocessorToAuxScalarTransfer
+    direction = from_multiapp
+    multi_app = candidates
+    from_postprocessor = calibration_misfit
+    to_aux_scalar = misfit
+    execute_on = initial
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+  execute_on = final
+  file_base = {file_base}
+[]
+"""
+
+ORDERS = ['CONSTANT', 'FIRST', 'SECOND', 'THIRD', 'FOURTH', 'FIFTH', 'SIXTH', 'SEVENTH', 'EIGHTH',
+          'NINTH', 'TENTH', 'ELEVENTH', 'TWELFTH', 'THIRTEENTH', 'FOURTEENTH', 'FIFTEENTH',
+          'SIXTEENTH', 'SEVENTEENTH', 'EIGHTTEENTH', 'NINETEENTH', 'TWENTIETH', 'TWENTYFIRST',
+          'TWENTYSECOND', 'TWENTYTHIRD', 'TWENTYFOURTH', 'TWENTYFIFTH', 'TWENTYSIXTH',
+          'TWENTYSEVENTH', 'TWENTYEIGHTH', 'TWENTYNINTH', 'THIRTIETH', 'THIRTYFIRST',
+          'THIRTYSECOND', 'THIRTYTHIRD', 'THIRTYFOURTH', 'THIRTYFIFTH', 'THIRTYSIXTH',
+          'THIRTYSEVENTH', 'THIRTYEIGHTH', 'THIRTYNINTH', 'FORTIETH', 'FORTYFIRST', 'FORTYSECOND',
+          'FORTYTHIRD']
+
+
+class Evaluator:
+    """Runs batches of parameter sets and returns their misfits."""
+
+    def __init__(self, args):
+        self.args = args
+        self.names = [p[0] for p in args.param]
+        self.work_dir = os.path.abspath(args.work_dir)
+        self.input = os.path.abspath(args.input)
+        self.experiment = os.path.abspath(args.experiment)
+        self.batches = 0
+        self.evaluations = 0
+        os.makedirs(self.work_dir, exist_ok=True)
+        self.history = os.path.join(self.work_dir, 'calibration_history.csv')
+        with open(self.history, 'w', newline='') as f:
+            csv.writer(f).writerow(['evaluation', 'batch'] + self.names + ['misfit'])
+
+    def cli_args(self, values, abort_misfit):
+        """Command line arguments of one candidate, setting its parameters and adding the misfit."""
+        a = self.args
+        misfit = 'Postprocessors/calibration_misfit/'
+        args = ['Materials/%s/%s=%.12g' % (a.material, n, v) for n, v in zip(self.names, values)]
+        args += [misfit + 'type=ExperimentCurveMisfit',
+                 misfit + 'file=' + self.experiment,
+                 misfit + 'x_column=' + a.x_column,
+                 misfit + 'y_column=' + a.y_column,
+                 misfit + 'x=' + a.x_pp,
+                 misfit + 'y=' + a.y_pp,
+                 misfit + 'x_scale=%.12g' % a.x_scale,
+                 misfit + 'y_scale=%.12g' % a.y_scale,
+                 misfit + 'abort_misfit=%.12g' % abort_misfit,
+                 'Outputs/exodus=false',
+                 'Outputs/perf_graph=false']
+        return args
+
+    def launch(self, input_file, extra_args, log_name):
+        command = [self.args.executable, '-i', input_file] + extra_args
+        if self.args.mpi_procs > 1:
+            command = ['mpiexec', '-n', str(self.args.mpi_procs)] + command
+        with open(os.path.join(self.work_dir, log_name), 'w') as log:
+            return subprocess.call(command, cwd=self.work_dir, stdout=log,
+                                   stderr=subprocess.STDOUT) == 0
+
+    def run_batch(self, candidates, abort_misfit):
+        """Misfits of all candidates from one launch, or None if the launch failed."""
+        file_base = 'batch_%04d' % self.batches
+        text = MASTER.format(
+            order=ORDERS[len(candidates)],
+            input=self.input,
+            positions=' '.join(['0 0 0'] * len(candidates)),
+            cli_args=' '.join(';'.join(self.cli_args(c, abort_misfit)) for c in candidates),
+            procs_per_app=self.args.procs_per_app,
+            file_base=file_base)
+        input_file = os.path.join(self.work_dir, file_base + '.i')
+        with open(input_file, 'w') as f:
+            f.write(text)
+
+        csv_file = os.path.join(self.work_dir, file_base + '.csv')
+        if not self.launch(input_file, [], file_base + '.log') or not os.path.exists(csv_file):
+            return None
+        with open(csv_file) as f:
+            rows = list(csv.DictReader(f))
+        if not rows:
+            return None
+        row = rows[-1]
+        keys = ['misfit'] if len(candidates) == 1 else ['misfit_%d' % i
+                                                        for i in range(len(candidates))]
+        try:
+            return [float(row[k]) for k in keys]
+        except (KeyError, ValueError):
+            return None
+
+    def run_single(self, values, abort_misfit, index):
+        """Misfit of one candidate run on its own; inf if it fails."""
+        file_base = 'single_%04d_%02d' % (self.batches, index)
+        args = self.cli_args(values, abort_misfit) + ['Outputs/csv=true',
+                                                      'Outputs/file_base=' + file_base]
+        csv_file = os.path.join(self.work_dir, file_base + '.csv')
+        if not self.launch(self.input, args, file_base + '.log') or not os.path.exists(csv_file):
+            return math.inf
+        with open(csv_file) as f:
+            rows = list(csv.DictReader(f))
+        try:
+            return float(rows[-1]['calibration_misfit'])
+        except (IndexError, KeyError, ValueError):
+            return math.inf
+
+    def __call__(self, candidates, abort_misfit=0.0):
+        misfits = []
+        for start in range(0, len(candidates), MAX_BATCH):
+            chunk = candidates[start:start + MAX_BATCH]
+            result = self.run_batch(chunk, abort_misfit)
+            if result is None:
+                result = [self.run_single(c, abort_misfit, i) for i, c in enumerate(chunk)]
+            misfits += [m if math.isfinite(m) else math.inf for m in result]
+            self.batches += 1
+
+        with open(self.history, 'a', newline='') as f:
+            writer = csv.writer(f)
+            for values, misfit in zip(candidates, misfits):
+                self.evaluations += 1
+                writer.writerow([self.evaluations, self.batches] + list(values) + [misfit])
+        return misfits
+
+
+def nelder_mead(evaluate, lower, upper, x0, args):
+    """Bounded Nelder-Mead in the unit cube with speculative batch evaluation of every step."""
+    n = len(x0)
+    span = [u - l for l, u in zip(lower, upper)]
+    to_physical = lambda z: [l + min(max(zi, 0.0), 1.0) * s for zi, l, s in zip(z, lower, span)]
+    z0 = [(x - l) / s for x, l, s in zip(x0, lower, span)]
+
+    simplex = [z0]
+    for i in range(n):
+        z = list(z0)
+        z[i] += args.initial_step if z[i] + args.initial_step <= 1.0 else -args.initial_step
+        simplex.append(z)
+    values = evaluate([to_physical(z) for z in simplex])
+
+    while evaluate.evaluations < args.max_evaluations:
+        order = sorted(range(n + 1), key=lambda i: values[i])
+        simplex = [simplex[i] for i in order]
+        values = [values[i] for i in order]
+
+        size = max(max(abs(a - b) for a, b in zip(z, simplex[0])) for z in simplex[1:])
+        print('evaluations %d  best %.6g  worst %.6g  size %.3g' %
+              (evaluate.evaluations, values[0], values[-1], size))
+        sys.stdout.flush()
+        if size < args.xtol or (math.isfinite(values[-1]) and values[-1] - values[0] < args.ftol):
+            break
+
+        centroid = [sum(z[i] for z in simplex[:-1]) / n for i in range(n)]
+        worst = simplex[-1]
+        step = lambda t: [c + t * (c - w) for c, w in zip(centroid, worst)]
+        reflected, expanded, outside, inside = step(1.0), step(2.0), step(0.5), step(-0.5)
+
+        abort = args.abort_factor * values[-1] if math.isfinite(values[-1]) else 0.0
+        fr, fe, fo, fi = evaluate([to_physical(z) for z in (reflected, expanded, outside, inside)],
+                                  abort)
+
+        if fr < values[0]:
+            simplex[-1], values[-1] = (expanded, fe) if fe < fr else (reflected, fr)
+        elif fr < values[-2]:
+            simplex[-1], values[-1] = reflected, fr
+        elif fr < values[-1] and fo <= fr:
+            simplex[-1], values[-1] = outside, fo
+        elif fr >= values[-1] and fi < values[-1]:
+            simplex[-1], values[-1] = inside, fi
+        else:
+            shrunk = [[b + 0.5 * (zi - b) for zi, b in zip(z, simplex[0])] for z in simplex[1:]]
+            simplex[1:] = shrunk
+            values[1:] = evaluate([to_physical(z) for z in shrunk], abort)
+
+    best = min(range(n + 1), key=lambda i: values[i])
+    return to_physical(simplex[best]), values[best]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executable', required=True)
+    parser.add_argument('--input', required=True, help='input file of a single run')
+    parser.add_argument('--experiment', required=True, help='CSV file of the experimental curve')
+    parser.add_argument('--material', required=True, help='name of the material block to calibrate')
+    parser.add_argument('--param', nargs=4, action='append', required=True,
+                        metavar=('NAME', 'LOWER', 'UPPER', 'INITIAL'),
+                        help='material parameter with its bounds and initial value')
+    parser.add_argument('--x-pp', default='disp_y', help='postprocessor of the simulated x')
+    parser.add_argument('--y-pp', default='force_y', help='postprocessor of the simulated y')
+    parser.add_argument('--x-column', default='Displacement')
+    parser.add_argument('--y-column', default='Force')
+    parser.add_argument('--x-scale', type=float, default=1.0)
+    parser.add_argument('--y-scale', type=float, default=1.0)
+    parser.add_argument('--mpi-procs', type=int, default=1, help='ranks of every launch')
+    parser.add_argument('--procs-per-app', type=int, default=1, help='ranks of every candidate')
+    parser.add_argument('--max-evaluations', type=int, default=200)
+    parser.add_argument('--initial-step', type=float, default=0.1,
+                        help='initial simplex step relative to the parameter ranges')
+    parser.add_argument('--xtol', type=float, default=1e-3,
+                        help='simplex size relative to the parameter ranges')
+    parser.add_argument('--ftol', type=float, default=1e-4, help='spread of the simplex misfits')
+    parser.add_argument('--abort-factor', type=float, default=2.0,
+                        help='terminate candidates beyond this multiple of the worst vertex')
+    parser.add_argument('--work-dir', default='calibration')
+    args = parser.parse_args()
+
+    names = [p[0] for p in args.param]
+    lower = [float(p[1]) for p in args.param]
+    upper = [float(p[2]) for p in args.param]
+    x0 = [float(p[3]) for p in args.param]
+    for name, l, u, x in zip(names, lower, upper, x0):
+        if not l < u or not l <= x <= u:
+            parser.error('parameter %s needs LOWER < UPPER and LOWER <= INITIAL <= UPPER' % name)
+
+    evaluate = Evaluator(args)
+    best, misfit = nelder_mead(evaluate, lower, upper, x0, args)
+
+    print('\nbest misfit %.6g after %d evaluations' % (misfit, evaluate.evaluations))
+    for name, value in zip(names, best):
+        print('  %s = %.8g' % (name, value))
+    return 0 if math.isfinite(misfit) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
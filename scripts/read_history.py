@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Readers for the columnar .npy histories written by the ColumnarHistory output.
+
+    from read_history import read_postprocessors, read_vector_postprocessor
+    pp = read_postprocessors('d_bending_out_history')            # pandas DataFrame
+    steps = read_vector_postprocessor('d_bending_out_history', 'envelope')
+"""
+import glob
+import os
+
+import numpy as np
+import pandas as pd
+
+
+def read_postprocessors(directory, mmap=True):
+    """Returns the postprocessor columns (time and one column per postprocessor) as a DataFrame."""
+    mode = 'r' if mmap else None
+    time = np.load(os.path.join(directory, 'time.npy'), mmap_mode=mode)
+    columns = {'time': time}
+    for path in sorted(glob.glob(os.path.join(directory, '*.npy'))):
+        name = os.path.basename(path)[:-4]
+        if '.' in name or name == 'time':
+            continue
+        columns[name] = np.load(path, mmap_mode=mode)[:len(time)]
+    return pd.DataFrame(columns)
+
+
+def read_vector_postprocessor(directory, vpp, mmap=True):
+    """Returns a list of (time, DataFrame) with the vectors of vpp at every output step."""
+    mode = 'r' if mmap else None
+    prefix = os.path.join(directory, vpp + '.')
+    time = np.load(prefix + 'time.npy', mmap_mode=mode)
+    offsets = np.load(prefix + 'offsets.npy', mmap_mode=mode).astype(np.int64)
+
+    vectors = {}
+    for path in sorted(glob.glob(prefix + '*.npy')):
+        name = path[len(prefix):-4]
+        if name not in ('time', 'offsets'):
+            vectors[name] = np.load(path, mmap_mode=mode)
+
+    ends = np.append(offsets[1:], len(next(iter(vectors.values()))) if vectors else 0)
+    return [(t, pd.DataFrame({k: v[b:e] for k, v in vectors.items()}))
+            for t, b, e in zip(time, offsets, ends)]
@@ -0,0 +1,153 @@
+# Ratcheting of a perfectly plastic cube under a constant axial stress and a cyclic shear strain.
+# The axial strain grows by the same amount in every cycle. The tests file runs 40 resolved cycles
+# (max_jump = 0) into reference/ and compares the final state of the run that jumps cycles with it,
+# which only holds if the jumps move the displacements by the ratcheting they skip.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+  []
+[]
+
+[Modules/TensorMechanics/Master]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'strain_xx stress_xx stress_yz plastic_strain_xx'
+  []
+[]
+
+[Functions]
+  [shear]
+    type = ParsedFunction
+    value = '0.005 * sin(2 * pi * t)'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 210
+    poissons_ratio = 0.3
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = 'plasticity'
+  []
+  [plasticity]
+    type = CombinedHardeningStressUpdatel
+    yield_stress = 0.25
+    hardening_constant = 0
+    cycle_jump = cycles
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = bottom
+    value = 0
+  []
+  [shear]
+    type = FunctionDirichletBC
+    variable = disp_z
+    boundary = top
+    function = shear
+  []
+  [axial_stress]
+    type = NeumannBC
+    variable = disp_x
+    boundary = right
+    value = 0.15
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  dt = 0.05
+  end_time = 100
+  [Predictor]
+    type = CycleJumpPredictor
+    cycle_jump = cycles
+  []
+[]
+
+[Postprocessors]
+  [rate_change]
+    type = ElementExtremeMaterialProperty
+    mat_prop = cycle_rate_change
+    value_type = max
+    outputs = none
+  []
+  [cycles]
+    type = CycleJump
+    cycle_period = 1
+    rate_change = rate_change
+    monitor_cycles = 3
+    max_jump = 10
+    num_cycles = 40
+  []
+  [strain_xx]
+    type = ElementAverageValue
+    variable = strain_xx
+  []
+  [plastic_strain_xx]
+    type = ElementAverageValue
+    variable = plastic_strain_xx
+  []
+  [stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  []
+  [stress_yz]
+    type = ElementAverageValue
+    variable = stress_yz
+  []
+[]
+
+[UserObjects]
+  [stop]
+    type = Terminator
+    expression = 'cycles >= 40'
+  []
+[]
+
+[Outputs]
+  # the jumped run ends earlier, so only the state after 40 equivalent cycles is compared
+  [csv]
+    type = CSV
+    execute_on = FINAL
+    time_column = false
+  []
+[]
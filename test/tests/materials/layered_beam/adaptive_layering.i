@@ -0,0 +1,178 @@
+# Simply supported layered beam loaded past yield by a prescribed mid-span deflection.
+# The moment-curvature history at mid-span must not depend on adaptive_layering: the tests
+# file runs this input with adaptive_layering = false into reference/ and compares the
+# default (adaptive) run against it.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 10
+    xmin = 0
+    xmax = 3000
+  []
+  [mid]
+    type = ExtraNodesetGenerator
+    new_boundary = mid
+    coord = '1500 0 0'
+    input = beam
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeaml
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = LayeredBeam
+    num_layers = 6
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    depth = 300
+    width = 150
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_stress = 0.25
+    hardening_constant = 2.1
+    outputs = all
+    output_properties = 'total_rot_strain'
+  []
+  [stress]
+    type = ComputeBeamResultantsl
+    outputs = all
+    output_properties = 'moments'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = mid
+    function = '5*t'
+  []
+[]
+
+[Kernels]
+  [solid_disp_x]
+    type = StressDivergenceBeaml
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 0
+  []
+  [solid_disp_y]
+    type = StressDivergenceBeaml
+    variable = disp_y
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 1
+  []
+  [solid_disp_z]
+    type = StressDivergenceBeaml
+    variable = disp_z
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 2
+  []
+  [solid_rot_x]
+    type = StressDivergenceBeaml
+    variable = rot_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 3
+  []
+  [solid_rot_y]
+    type = StressDivergenceBeaml
+    variable = rot_y
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 4
+  []
+  [solid_rot_z]
+    type = StressDivergenceBeaml
+    variable = rot_z
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 5
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.5
+  end_time = 6
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-8
+[]
+
+[Postprocessors]
+  # sampled inside the element left of mid-span, where the section yields first
+  [moment]
+    type = PointValue
+    point = '1450 0 0'
+    variable = moments_z
+  []
+  [curvature]
+    type = PointValue
+    point = '1450 0 0'
+    variable = total_rot_strain_z
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
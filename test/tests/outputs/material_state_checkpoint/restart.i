@@ -0,0 +1,142 @@
+# Cyclic tension-compression of a kinematic hardening bar. The tests file runs it uninterrupted
+# into reference/, then stops it at t = 1.5 and restarts it with the regular checkpoint plus the
+# material state checkpoint, and compares the final material state of both runs.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [bar]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    xmax = 4
+  []
+[]
+
+[Modules/TensorMechanics/Master]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'stress_xx plastic_strain_xx effective_plastic_strain'
+  []
+[]
+
+[AuxVariables]
+  [back_stress_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [back_stress_xx]
+    type = RankTwoAux
+    rank_two_tensor = back_stress
+    variable = back_stress_xx
+    index_i = 0
+    index_j = 0
+  []
+[]
+
+[Functions]
+  [load]
+    type = PiecewiseLinear
+    x = '0 1 2 3'
+    y = '0 0.02 -0.02 0.01'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 210
+    poissons_ratio = 0.3
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = 'kinematic_plasticity'
+  []
+  [kinematic_plasticity]
+    type = KinematicPlasticityStressUpdate
+    yield_stress = 0.25
+    hardening_constant = 21
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = load
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  dt = 0.1
+  end_time = 3
+[]
+
+[Postprocessors]
+  [stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  []
+  [plastic_strain_xx]
+    type = ElementAverageValue
+    variable = plastic_strain_xx
+  []
+  [effective_plastic_strain]
+    type = ElementAverageValue
+    variable = effective_plastic_strain
+  []
+  [back_stress_xx]
+    type = ElementAverageValue
+    variable = back_stress_xx
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = FINAL
+  []
+  [material_state]
+    type = MaterialStateCheckpoint
+    full_interval = 4
+  []
+[]
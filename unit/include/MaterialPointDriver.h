@@ -0,0 +1,231 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "RadialReturnPointModels.h"
+
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+#include <array>
+
+/**
+ * Material point of one of the radial return models of RadialReturnPointModels.h with an
+ * isotropic elasticity tensor, integrated with the same integrateStep the materials call.
+ * compute() evaluates a trial total strain from the committed state without changing it;
+ * commit() accepts the last evaluation. A step the point model rejects throws a MooseException.
+ * jump() applies a cycle jump the way the materials with a cycle_jump parameter do.
+ */
+template <typename Point>
+class RadialReturnPointModel
+{
+public:
+  typedef typename Point::State State;
+  typedef typename Point::StepState StepState;
+
+  RadialReturnPointModel(const Point & point, Real youngs_modulus, Real poissons_ratio)
+    : _point(point),
+      _bulk_modulus(youngs_modulus / (3.0 * (1.0 - 2.0 * poissons_ratio))),
+      _shear_modulus(youngs_modulus / (2.0 * (1.0 + poissons_ratio))),
+      _effective_plastic_strain(0.0)
+  {
+    _elasticity_tensor.fillFromInputVector(
+        {_bulk_modulus - 2.0 / 3.0 * _shear_modulus, _shear_modulus},
+        RankFourTensor::symmetric_isotropic);
+    _point.initState(_committed.state);
+    _committed.effective_inelastic_strain = 0.0;
+  }
+
+  /// Stress (and the consistent tangent if requested) for the total strain
+  void compute(const RankTwoTensor & strain, RankTwoTensor & stress, RankFourTensor * tangent)
+  {
+    // inelastic strains of the step state are accumulated over the increment only
+    StepState start = _committed;
+    start.inelastic_strain.zero();
+    start.effective_inelastic_strain = 0.0;
+
+    const RankTwoTensor strain_increment = strain - _committed.total_strain;
+    unsigned int iterations = 0;
+    _point.integrateStep(start,
+                         strain_increment,
+                         strain_increment,
+                         _elasticity_tensor,
+                         _trial,
+                         _return_data,
+                         iterations);
+    stress = _trial.stress;
+
+    if (tangent)
+      *tangent = RadialReturnCore::consistentTangent(_bulk_modulus, _shear_modulus, _return_data);
+  }
+
+  void commit()
+  {
+    _plastic_strain += _trial.inelastic_strain;
+    _effective_plastic_strain += _trial.effective_inelastic_strain;
+    _committed = _trial;
+  }
+
+  /// Adds the plastic strain of jumped cycles and takes it out of the committed elastic strain
+  void jump(const RankTwoTensor & plastic_strain)
+  {
+    _committed.elastic_strain -= plastic_strain;
+    _committed.stress -= _elasticity_tensor * plastic_strain;
+    _plastic_strain += plastic_strain;
+  }
+
+  const State & state() const { return _committed.state; }
+  const RankTwoTensor & plasticStrain() const { return _plastic_strain; }
+  Real effectivePlasticStrain() const { return _effective_plastic_strain; }
+
+protected:
+  const Point _point;
+  const Real _bulk_modulus;
+  const Real _shear_modulus;
+  RankFourTensor _elasticity_tensor;
+
+  StepState _committed;
+  StepState _trial;
+  RankTwoTensor _plastic_strain;
+  Real _effective_plastic_strain;
+  RadialReturnCore::ReturnData _return_data;
+};
+
+/**
+ * Drives a point model along a strain or mixed stress-strain path without a mesh. Every Voigt
+ * component (xx, yy, zz, yz, xz, xy) is either strain or stress controlled; the strains of the
+ * stress controlled components are found by Newton iterations with the consistent tangent of the
+ * model. Purely strain controlled increments need a single evaluation and skip the tangent.
+ *
+ * Model must provide compute(strain, stress, tangent pointer) and commit() like
+ * RadialReturnPointModel.
+ */
+template <typename Model>
+class MaterialPointDriver
+{
+public:
+  typedef std::array<bool, 6> Control;
+
+  MaterialPointDriver(Model & model, Real tolerance = 1e-12, unsigned int max_its = 25)
+    : _model(model), _tolerance(tolerance), _max_its(max_its)
+  {
+  }
+
+  /// Every component strain controlled
+  static Control strainControl() { return Control{{false, false, false, false, false, false}}; }
+
+  /// Uniaxial stress along xx: xx strain controlled, all other stress components zero
+  static Control uniaxialStress() { return Control{{false, true, true, true, true, true}}; }
+
+  /**
+   * Applies one increment. Strain controlled components of the strain are set from target_strain,
+   * stress controlled components of the stress are driven to target_stress. Returns false if the
+   * Newton iterations did not converge or the model rejected the step; the state is then not
+   * committed.
+   */
+  bool increment(const Control & stress_control,
+                 const RankTwoTensor & target_strain,
+                 const RankTwoTensor & target_stress)
+  {
+    std::vector<unsigned int> unknowns;
+    for (unsigned int i = 0; i < 6; ++i)
+    {
+      if (stress_control[i])
+        unknowns.push_back(i);
+      else
+        setComponent(_strain, i, component(target_strain, i));
+    }
+
+    try
+    {
+      if (unknowns.empty())
+      {
+        _model.compute(_strain, _stress, nullptr);
+        _model.commit();
+        return true;
+      }
+      return solve(unknowns, target_stress);
+    }
+    catch (MooseException &)
+    {
+      return false;
+    }
+  }
+
+  const RankTwoTensor & strain() const { return _strain; }
+  const RankTwoTensor & stress() const { return _stress; }
+
+  /// Shifts the starting strain of the next increment, like CycleJumpPredictor after a jump
+  void predict(const RankTwoTensor & strain_increment) { _strain += strain_increment; }
+
+protected:
+  /// Newton iterations on the strains of the stress controlled components
+  bool solve(const std::vector<unsigned int> & unknowns, const RankTwoTensor & target_stress)
+  {
+    const unsigned int n = unknowns.size();
+    DenseMatrix<Real> jacobian(n, n);
+    DenseVector<Real> residual(n), correction(n);
+    RankFourTensor tangent;
+
+    for (unsigned int it = 0; it < _max_its; ++it)
+    {
+      _model.compute(_strain, _stress, &tangent);
+
+      Real norm = 0.0;
+      for (unsigned int a = 0; a < n; ++a)
+      {
+        residual(a) = component(target_stress, unknowns[a]) - component(_stress, unknowns[a]);
+        norm = std::max(norm, std::abs(residual(a)));
+      }
+      if (norm <= _tolerance)
+      {
+        _model.commit();
+        return true;
+      }
+
+      for (unsigned int a = 0; a < n; ++a)
+        for (unsigned int b = 0; b < n; ++b)
+          jacobian(a, b) = voigtTangent(tangent, unknowns[a], unknowns[b]);
+      jacobian.lu_solve(residual, correction);
+
+      for (unsigned int a = 0; a < n; ++a)
+        setComponent(_strain, unknowns[a], component(_strain, unknowns[a]) + correction(a));
+    }
+    return false;
+  }
+
+  /// Tensor indices of the Voigt components
+  static unsigned int row(unsigned int i) { return i < 3 ? i : (i == 3 ? 1 : 0); }
+  static unsigned int col(unsigned int i) { return i < 3 ? i : (i == 5 ? 1 : 2); }
+
+  static Real component(const RankTwoTensor & t, unsigned int i) { return t(row(i), col(i)); }
+
+  static void setComponent(RankTwoTensor & t, unsigned int i, Real value)
+  {
+    t(row(i), col(i)) = value;
+    t(col(i), row(i)) = value;
+  }
+
+  /// Derivative of stress component i with respect to the (symmetric) strain component j
+  static Real voigtTangent(const RankFourTensor & tangent, unsigned int i, unsigned int j)
+  {
+    Real value = tangent(row(i), col(i), row(j), col(j));
+    if (j >= 3)
+      value += tangent(row(i), col(i), col(j), row(j));
+    return value;
+  }
+
+  Model & _model;
+  const Real _tolerance;
+  const unsigned int _max_its;
+
+  RankTwoTensor _strain;
+  RankTwoTensor _stress;
+};